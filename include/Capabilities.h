@@ -0,0 +1,75 @@
+/* Capabilities.h - recursos do contexto OpenGL, consultados uma vez no início
+ *
+ * Depois do gladLoadGLLoader, detectCapabilities() resume a versão e as
+ * extensões em flags simples que o renderizador consulta para escolher os
+ * caminhos rápidos (buffer persistente, multi-draw indireto, bindless,
+ * compilação paralela de shaders). Uma extensão vale se a versão do contexto
+ * já a inclui no core ou se ela aparece no registro de extensões do glad.
+ *
+ * Extensões fora dessa lista podem ser consultadas com hasExtension(), que usa
+ * a tabela hash montada pelo glad (sem percorrer a lista de extensões).
+ */
+
+#pragma once
+
+#include <iostream>
+
+#include <glad/glad.h>
+
+struct Capabilities
+{
+	int major = 0, minor = 0;
+	int extensionCount = 0;
+
+	bool directStateAccess = false;		 // GL 4.5 / ARB_direct_state_access
+	bool bufferStorage = false;				 // GL 4.4 / ARB_buffer_storage
+	bool multiDrawIndirect = false;		 // GL 4.3 / ARB_multi_draw_indirect
+	bool indirectParameters = false;	 // GL 4.6 / ARB_indirect_parameters
+	bool shaderDrawParameters = false; // GL 4.6 / ARB_shader_draw_parameters (gl_DrawID)
+	bool bindlessTexture = false;			 // ARB_bindless_texture
+	bool parallelShaderCompile = false; // KHR_parallel_shader_compile
+	bool debugOutput = false;					 // GL 4.3 / KHR_debug
+};
+
+inline Capabilities &capabilities()
+{
+	static Capabilities caps;
+	return caps;
+}
+
+inline bool hasExtension(const char *name)
+{
+	return gladHasExtension(name) != 0;
+}
+
+// Preenche capabilities() a partir do contexto atual (chamar depois do gladLoadGLLoader)
+inline const Capabilities &detectCapabilities()
+{
+	Capabilities &caps = capabilities();
+	caps.major = GLVersion.major;
+	caps.minor = GLVersion.minor;
+	caps.extensionCount = gladExtensionCount();
+
+	caps.directStateAccess = GLAD_GL_VERSION_4_5 || GLAD_GL_ARB_direct_state_access;
+	caps.bufferStorage = GLAD_GL_VERSION_4_4 || GLAD_GL_ARB_buffer_storage;
+	caps.multiDrawIndirect = GLAD_GL_VERSION_4_3 || GLAD_GL_ARB_multi_draw_indirect;
+	caps.indirectParameters = GLAD_GL_VERSION_4_6 || GLAD_GL_ARB_indirect_parameters;
+	caps.shaderDrawParameters = GLAD_GL_VERSION_4_6 || GLAD_GL_ARB_shader_draw_parameters;
+	caps.bindlessTexture = GLAD_GL_ARB_bindless_texture;
+	caps.parallelShaderCompile = GLAD_GL_KHR_parallel_shader_compile;
+	caps.debugOutput = GLAD_GL_VERSION_4_3 || GLAD_GL_KHR_debug;
+	return caps;
+}
+
+inline void printCapabilities(const Capabilities &caps)
+{
+	auto flag = [](bool value)
+	{ return value ? "sim" : "nao"; };
+	std::cout << "Recursos: DSA " << flag(caps.directStateAccess)
+						<< ", buffer storage " << flag(caps.bufferStorage)
+						<< ", multi-draw indireto " << flag(caps.multiDrawIndirect)
+						<< ", gl_DrawID " << flag(caps.shaderDrawParameters)
+						<< ", bindless " << flag(caps.bindlessTexture)
+						<< ", compilacao paralela " << flag(caps.parallelShaderCompile)
+						<< " (" << caps.extensionCount << " extensoes)" << std::endl;
+}
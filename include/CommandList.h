@@ -0,0 +1,219 @@
+/* CommandList.h - listas de comandos gravadas em paralelo, executadas no thread principal
+ *
+ * Só o thread principal tem o contexto OpenGL, mas montar os comandos de um
+ * frame (percorrer a cena, calcular matrizes, decidir estado) não precisa dele.
+ * Uma CommandList grava comandos sem tocar na OpenGL: troca de programa e de
+ * VAO, escrita de uniform e draws, cada um um registro pequeno (cabeçalho +
+ * dados) num vetor de bytes da própria lista. Cada thread grava na sua lista
+ * (sem trava, sem alocação depois do primeiro frame: reset() mantém a memória).
+ *
+ * recordParallel divide [0, count) em faixas contíguas, uma lista por faixa;
+ * replayAll executa as listas na ordem das faixas, pelo RenderState. A ordem
+ * dos comandos na OpenGL é a mesma de um laço sequencial, qualquer que seja o
+ * número de threads ou quem terminar primeiro.
+ *
+ * Os valores são inteiros simples (nomes, enums, locations), então a gravação
+ * não depende da API; só replay() sabe da OpenGL.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <Parallel.h>
+#include <RenderState.h>
+
+// Abaixo disso por bloco, agendar a tarefa no JobSystem (e acordar um
+// trabalhador) custa mais que gravar os comandos
+const size_t COMMANDS_MIN_PER_THREAD = 2048;
+
+enum CommandOp : uint8_t
+{
+	CMD_USE_PROGRAM,
+	CMD_BIND_VERTEX_ARRAY,
+	CMD_BIND_MATERIAL, // estado do material, aplicado por quem chama o replay
+	CMD_UNIFORM_INT,
+	CMD_UNIFORM_MAT4,
+	CMD_DRAW_ELEMENTS,
+	CMD_DRAW_ARRAYS,
+	CMD_CALLBACK // função chamada no replay (multi-draw do lote, ...)
+};
+
+class CommandList
+{
+public:
+	// Começo do frame: esvazia a lista (a memória fica para o próximo)
+	void reset()
+	{
+		data.clear();
+		count = 0;
+	}
+
+	void useProgram(uint32_t program) { write(CMD_USE_PROGRAM, program); }
+	void bindVertexArray(uint32_t vertexArray) { write(CMD_BIND_VERTEX_ARRAY, vertexArray); }
+	void bindMaterial(uint32_t material) { write(CMD_BIND_MATERIAL, material); }
+
+	void uniform(int32_t location, int32_t value)
+	{
+		if (location >= 0)
+			write(CMD_UNIFORM_INT, UniformInt{location, value});
+	}
+	void uniform(int32_t location, const glm::mat4 &value)
+	{
+		if (location >= 0)
+			write(CMD_UNIFORM_MAT4, UniformMat4{location, value});
+	}
+
+	// instances > 1 vira glDrawElementsInstanced
+	void drawElements(uint32_t mode, int32_t indexCount, uint32_t indexType, int32_t instances = 1)
+	{
+		write(CMD_DRAW_ELEMENTS, DrawElements{mode, indexCount, indexType, instances});
+	}
+	void drawArrays(uint32_t mode, int32_t first, int32_t vertexCount) { write(CMD_DRAW_ARRAYS, DrawArrays{mode, first, vertexCount}); }
+
+	// A função precisa continuar viva até o replay
+	void callback(const std::function<void()> *function) { write(CMD_CALLBACK, function); }
+
+	size_t commands() const { return count; }
+	size_t bytes() const { return data.size(); }
+
+	// Executa os comandos no contexto atual (só no thread principal)
+	void replay(RenderState &state, const std::function<void(uint32_t material)> &bindMaterial = nullptr) const
+	{
+		const uint8_t *p = data.data(), *end = p + data.size();
+		while (p < end)
+		{
+			Header header;
+			memcpy(&header, p, sizeof(header));
+			const uint8_t *payload = p + sizeof(header);
+			p = payload + header.size;
+			switch (header.op)
+			{
+			case CMD_USE_PROGRAM:
+				state.useProgram(read<uint32_t>(payload));
+				break;
+			case CMD_BIND_VERTEX_ARRAY:
+				state.bindVertexArray(read<uint32_t>(payload));
+				break;
+			case CMD_BIND_MATERIAL:
+				if (bindMaterial)
+					bindMaterial(read<uint32_t>(payload));
+				break;
+			case CMD_UNIFORM_INT:
+			{
+				UniformInt u = read<UniformInt>(payload);
+				state.uniform(u.location, (GLint)u.value);
+				break;
+			}
+			case CMD_UNIFORM_MAT4:
+			{
+				UniformMat4 u = read<UniformMat4>(payload);
+				state.uniform(u.location, u.value);
+				break;
+			}
+			case CMD_DRAW_ELEMENTS:
+			{
+				DrawElements d = read<DrawElements>(payload);
+				if (d.instances == 1)
+					glDrawElements(d.mode, d.count, d.indexType, 0);
+				else
+					glDrawElementsInstanced(d.mode, d.count, d.indexType, 0, d.instances);
+				break;
+			}
+			case CMD_DRAW_ARRAYS:
+			{
+				DrawArrays d = read<DrawArrays>(payload);
+				glDrawArrays(d.mode, d.first, d.count);
+				break;
+			}
+			case CMD_CALLBACK:
+			{
+				const std::function<void()> *function = read<const std::function<void()> *>(payload);
+				if (function && *function)
+					(*function)();
+				break;
+			}
+			}
+		}
+	}
+
+private:
+	struct Header
+	{
+		CommandOp op;
+		uint32_t size; // bytes dos dados depois do cabeçalho
+	};
+	struct UniformInt
+	{
+		int32_t location, value;
+	};
+	struct UniformMat4
+	{
+		int32_t location;
+		glm::mat4 value;
+	};
+	struct DrawElements
+	{
+		uint32_t mode;
+		int32_t count;
+		uint32_t indexType;
+		int32_t instances;
+	};
+	struct DrawArrays
+	{
+		uint32_t mode;
+		int32_t first, count;
+	};
+
+	// Registros não ficam alinhados no vetor: leitura e escrita por memcpy
+	template <typename T>
+	void write(CommandOp op, const T &payload)
+	{
+		const Header header = {op, (uint32_t)sizeof(T)};
+		const size_t at = data.size();
+		data.resize(at + sizeof(header) + sizeof(T));
+		memcpy(data.data() + at, &header, sizeof(header));
+		memcpy(data.data() + at + sizeof(header), &payload, sizeof(T));
+		count++;
+	}
+
+	template <typename T>
+	static T read(const uint8_t *p)
+	{
+		T value;
+		memcpy(&value, p, sizeof(T));
+		return value;
+	}
+
+	std::vector<uint8_t> data;
+	size_t count = 0;
+};
+
+// Grava [0, count) em faixas contíguas, record(lista, primeiro, último) em
+// paralelo. Usa no máximo lists.size() listas (ajusta o tamanho se estiver
+// vazio) e devolve quantas foram usadas; as outras ficam vazias.
+template <typename Function>
+size_t recordParallel(std::vector<CommandList> &lists, size_t count, Function record)
+{
+	if (lists.empty())
+		lists.resize(workerThreadCount());
+	for (CommandList &list : lists)
+		list.reset();
+	return runParallelRanges(count, COMMANDS_MIN_PER_THREAD, [&](size_t chunk, size_t first, size_t last)
+													 { record(lists[chunk], first, last); }, lists.size());
+}
+
+// Executa as listas na ordem das faixas
+inline void replayAll(const std::vector<CommandList> &lists, RenderState &state,
+											const std::function<void(uint32_t material)> &bindMaterial = nullptr)
+{
+	for (const CommandList &list : lists)
+		list.replay(state, bindMaterial);
+}
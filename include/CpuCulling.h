@@ -0,0 +1,368 @@
+/* CpuCulling.h - culling por frustum na CPU, 8 esferas por vez
+ *
+ * Alternativa ao GpuCulling.h quando não há compute shader (ou para comparar).
+ * As esferas ficam em estrutura de arrays (x[], y[], z[], raio[]), então um
+ * registrador AVX carrega a mesma coordenada de 8 objetos seguidos e cada plano
+ * custa 3 multiplicações/somas para os 8. Sem AVX2 o mesmo laço roda com SSE
+ * (4 + 4) e, fora do x86, em C++ escalar.
+ *
+ * O caminho é escolhido em tempo de execução (detectSimdPath), então o
+ * executável não precisa ser compilado com -mavx2.
+ *
+ * O resultado é uma máscara de bits: um byte por grupo de 8 objetos, bit i =
+ * objeto 8 * grupo + i visível. Faixas de grupos são divididas entre threads
+ * (cada uma escreve só os seus bytes).
+ *
+ * CpuBatchCulling aplica o resultado a um DrawBatch do mesmo jeito que o
+ * GpuCulling: instanceCount de cada comando = objetos visíveis, e a lista de
+ * visíveis (lida pelo vertex shader no binding BATCH_VISIBLE_BINDING) vai por um
+ * FrameRing.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <glm/glm.hpp>
+
+#include <glad/glad.h>
+
+#include <FrameRing.h>
+#include <Frustum.h>
+#include <MeshBatch.h>
+#include <Parallel.h>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#define CULL_X86 1
+#include <immintrin.h>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+#endif
+
+// GCC/Clang só aceitam intrínsecos AVX2 em funções marcadas com o alvo; o MSVC aceita sempre
+#if defined(CULL_X86) && (defined(__GNUC__) || defined(__clang__))
+#define CULL_TARGET(isa) __attribute__((target(isa)))
+#else
+#define CULL_TARGET(isa)
+#endif
+
+enum SimdPath
+{
+	SIMD_SCALAR,
+	SIMD_SSE4,
+	SIMD_AVX2
+};
+
+inline const char *simdPathName(SimdPath path)
+{
+	switch (path)
+	{
+	case SIMD_AVX2:
+		return "AVX2";
+	case SIMD_SSE4:
+		return "SSE4";
+	default:
+		return "escalar";
+	}
+}
+
+// Melhor caminho suportado pelo processador (e pelo sistema, no caso do AVX)
+inline SimdPath detectSimdPath()
+{
+#if defined(CULL_X86) && (defined(__GNUC__) || defined(__clang__))
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+		return SIMD_AVX2;
+	if (__builtin_cpu_supports("sse4.1"))
+		return SIMD_SSE4;
+#elif defined(CULL_X86) && defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 1);
+	const bool sse41 = (info[2] & (1 << 19)) != 0;
+	const bool fma = (info[2] & (1 << 12)) != 0;
+	const bool osSavesAvx = (info[2] & (1 << 27)) != 0 && (_xgetbv(0) & 6) == 6;
+	__cpuidex(info, 7, 0);
+	const bool avx2 = (info[1] & (1 << 5)) != 0;
+	if (avx2 && fma && osSavesAvx)
+		return SIMD_AVX2;
+	if (sse41)
+		return SIMD_SSE4;
+#endif
+	return SIMD_SCALAR;
+}
+
+// Esferas envolventes em estrutura de arrays. Os arrays têm sempre tamanho
+// múltiplo de 8 (o resto é zero), para o último grupo poder ser lido inteiro.
+struct SphereArrays
+{
+	std::vector<float> x, y, z, radius;
+
+	size_t size() const { return count; }
+	size_t groups() const { return (count + 7) / 8; }
+
+	void clear()
+	{
+		x.clear();
+		y.clear();
+		z.clear();
+		radius.clear();
+		count = 0;
+	}
+
+	void reserve(size_t n)
+	{
+		const size_t padded = (n + 7) & ~(size_t)7;
+		x.reserve(padded);
+		y.reserve(padded);
+		z.reserve(padded);
+		radius.reserve(padded);
+	}
+
+	void push_back(const glm::vec4 &sphere)
+	{
+		if (count % 8 == 0)
+		{
+			x.resize(count + 8, 0.0f);
+			y.resize(count + 8, 0.0f);
+			z.resize(count + 8, 0.0f);
+			radius.resize(count + 8, 0.0f);
+		}
+		x[count] = sphere.x;
+		y[count] = sphere.y;
+		z[count] = sphere.z;
+		radius[count] = sphere.w;
+		count++;
+	}
+
+private:
+	size_t count = 0;
+};
+
+inline bool maskVisible(const std::vector<uint8_t> &mask, size_t i)
+{
+	return (mask[i / 8] >> (i % 8)) & 1;
+}
+
+// Número de bits ligados num byte da máscara
+inline unsigned maskCount(uint8_t bits)
+{
+	unsigned n = 0;
+	for (; bits; bits &= bits - 1)
+		n++;
+	return n;
+}
+
+// Um kernel por caminho: testa os grupos [firstGroup, lastGroup) e grava um byte por grupo
+
+inline void cullGroupsScalar(const glm::vec4 planes[6], const SphereArrays &spheres, size_t firstGroup, size_t lastGroup, uint8_t *mask)
+{
+	for (size_t group = firstGroup; group < lastGroup; group++)
+	{
+		uint8_t bits = 0;
+		for (size_t lane = 0; lane < 8; lane++)
+		{
+			const size_t i = group * 8 + lane;
+			bool inside = true;
+			for (int p = 0; p < 6 && inside; p++)
+				inside = planes[p].x * spheres.x[i] + planes[p].y * spheres.y[i] + planes[p].z * spheres.z[i] + planes[p].w >= -spheres.radius[i];
+			bits |= (uint8_t)(inside << lane);
+		}
+		mask[group] = bits;
+	}
+}
+
+#ifdef CULL_X86
+CULL_TARGET("sse4.1")
+inline void cullGroupsSse4(const glm::vec4 planes[6], const SphereArrays &spheres, size_t firstGroup, size_t lastGroup, uint8_t *mask)
+{
+	__m128 a[6], b[6], c[6], d[6];
+	for (int p = 0; p < 6; p++)
+	{
+		a[p] = _mm_set1_ps(planes[p].x);
+		b[p] = _mm_set1_ps(planes[p].y);
+		c[p] = _mm_set1_ps(planes[p].z);
+		d[p] = _mm_set1_ps(planes[p].w);
+	}
+	const __m128 zero = _mm_setzero_ps();
+	for (size_t group = firstGroup; group < lastGroup; group++)
+	{
+		int bits = 0;
+		for (size_t half = 0; half < 2; half++)
+		{
+			const size_t i = group * 8 + half * 4;
+			const __m128 x = _mm_loadu_ps(&spheres.x[i]);
+			const __m128 y = _mm_loadu_ps(&spheres.y[i]);
+			const __m128 z = _mm_loadu_ps(&spheres.z[i]);
+			const __m128 negativeRadius = _mm_sub_ps(zero, _mm_loadu_ps(&spheres.radius[i]));
+			__m128 outside = zero;
+			for (int p = 0; p < 6; p++)
+			{
+				__m128 distance = _mm_add_ps(_mm_add_ps(_mm_mul_ps(a[p], x), _mm_mul_ps(b[p], y)), _mm_add_ps(_mm_mul_ps(c[p], z), d[p]));
+				outside = _mm_or_ps(outside, _mm_cmplt_ps(distance, negativeRadius));
+			}
+			bits |= (~_mm_movemask_ps(outside) & 0xF) << (half * 4);
+		}
+		mask[group] = (uint8_t)bits;
+	}
+}
+
+CULL_TARGET("avx2,fma")
+inline void cullGroupsAvx2(const glm::vec4 planes[6], const SphereArrays &spheres, size_t firstGroup, size_t lastGroup, uint8_t *mask)
+{
+	__m256 a[6], b[6], c[6], d[6];
+	for (int p = 0; p < 6; p++)
+	{
+		a[p] = _mm256_set1_ps(planes[p].x);
+		b[p] = _mm256_set1_ps(planes[p].y);
+		c[p] = _mm256_set1_ps(planes[p].z);
+		d[p] = _mm256_set1_ps(planes[p].w);
+	}
+	const __m256 zero = _mm256_setzero_ps();
+	for (size_t group = firstGroup; group < lastGroup; group++)
+	{
+		const size_t i = group * 8;
+		const __m256 x = _mm256_loadu_ps(&spheres.x[i]);
+		const __m256 y = _mm256_loadu_ps(&spheres.y[i]);
+		const __m256 z = _mm256_loadu_ps(&spheres.z[i]);
+		const __m256 negativeRadius = _mm256_sub_ps(zero, _mm256_loadu_ps(&spheres.radius[i]));
+		__m256 outside = zero;
+		for (int p = 0; p < 6; p++)
+		{
+			__m256 distance = _mm256_fmadd_ps(a[p], x, _mm256_fmadd_ps(b[p], y, _mm256_fmadd_ps(c[p], z, d[p])));
+			outside = _mm256_or_ps(outside, _mm256_cmp_ps(distance, negativeRadius, _CMP_LT_OQ));
+		}
+		mask[group] = (uint8_t)~_mm256_movemask_ps(outside);
+	}
+}
+#endif
+
+inline void cullGroups(SimdPath path, const glm::vec4 planes[6], const SphereArrays &spheres, size_t firstGroup, size_t lastGroup, uint8_t *mask)
+{
+#ifdef CULL_X86
+	if (path == SIMD_AVX2)
+		return cullGroupsAvx2(planes, spheres, firstGroup, lastGroup, mask);
+	if (path == SIMD_SSE4)
+		return cullGroupsSse4(planes, spheres, firstGroup, lastGroup, mask);
+#endif
+	cullGroupsScalar(planes, spheres, firstGroup, lastGroup, mask);
+}
+
+// Abaixo disso por bloco, agendar a tarefa no JobSystem (e acordar um
+// trabalhador) custa mais que o teste
+const size_t CULL_MIN_GROUPS_PER_THREAD = 4096;
+
+// Preenche mask (um byte por 8 esferas) e devolve quantas esferas estão visíveis.
+// threads = 0 usa todos os núcleos.
+inline size_t cullSpheres(const glm::vec4 planes[6], const SphereArrays &spheres, std::vector<uint8_t> &mask,
+													SimdPath path, unsigned threads = 0)
+{
+	const size_t groups = spheres.groups();
+	mask.resize(groups);
+	if (groups == 0)
+		return 0;
+
+	size_t chunks = threads ? threads : workerThreadCount();
+	chunks = std::max<size_t>(1, std::min(chunks, groups / CULL_MIN_GROUPS_PER_THREAD));
+	const size_t groupsPerChunk = (groups + chunks - 1) / chunks;
+	std::vector<size_t> visible(chunks, 0);
+
+	runParallel(chunks, [&](size_t chunk)
+							{
+		const size_t first = std::min(groups, chunk * groupsPerChunk);
+		const size_t last = std::min(groups, first + groupsPerChunk);
+		cullGroups(path, planes, spheres, first, last, mask.data());
+		// O último grupo pode ter menos de 8 esferas: o resto não conta
+		if (first < last && last == groups && spheres.size() % 8)
+			mask[groups - 1] &= (uint8_t)((1u << (spheres.size() % 8)) - 1);
+		size_t count = 0;
+		for (size_t group = first; group < last; group++)
+			count += maskCount(mask[group]);
+		visible[chunk] = count; });
+
+	size_t total = 0;
+	for (size_t count : visible)
+		total += count;
+	return total;
+}
+
+
+// Culling de um DrawBatch na CPU: reescreve os comandos e a lista de visíveis a cada frame
+class CpuBatchCulling
+{
+public:
+	~CpuBatchCulling() { destroy(); }
+
+	bool create(const MeshArena &arena, const DrawBatch &batch, unsigned framesInFlight, unsigned threadCount = 0)
+	{
+		destroy();
+		commandBuffer = batch.commandBufferId();
+		sourceCommands = batch.commandList();
+		commands = sourceCommands;
+		threads = threadCount;
+		path = detectSimdPath();
+
+		// Objetos parados: as esferas no espaço do mundo são calculadas uma vez
+		spheres.reserve(batch.objects());
+		for (size_t c = 0; c < sourceCommands.size(); c++)
+		{
+			const ArenaMesh &mesh = arena.mesh(batch.commandMesh(c));
+			const glm::vec4 sphere = boundingSphere(mesh.boundsMin, mesh.boundsMax);
+			for (GLuint i = 0; i < sourceCommands[c].instanceCount; i++)
+				spheres.push_back(transformSphere(batch.objectModel(sourceCommands[c].baseInstance + i), sphere));
+		}
+		return visibleRing.create(GL_SHADER_STORAGE_BUFFER, std::max<size_t>(spheres.size(), 1) * sizeof(GLuint), framesInFlight);
+	}
+
+	void destroy()
+	{
+		visibleRing.destroy();
+		spheres.clear();
+		sourceCommands.clear();
+		commands.clear();
+		commandBuffer = 0;
+	}
+
+	// Testa todos os objetos e deixa os comandos e a lista de visíveis prontos para o desenho
+	void cull(const glm::mat4 &viewProjection)
+	{
+		glm::vec4 planes[6];
+		extractFrustumPlanes(viewProjection, planes);
+		lastVisible = cullSpheres(planes, spheres, mask, path, threads);
+
+		// Compacta os visíveis de cada comando a partir do seu baseInstance
+		GLuint *visible = (GLuint *)visibleRing.beginFrame();
+		for (size_t c = 0; c < sourceCommands.size(); c++)
+		{
+			const GLuint first = sourceCommands[c].baseInstance;
+			GLuint count = 0;
+			for (GLuint i = first; i < first + sourceCommands[c].instanceCount; i++)
+				if (maskVisible(mask, i))
+					visible[first + count++] = i;
+			commands[c].instanceCount = count;
+		}
+		visibleRing.endWrite();
+		visibleRing.bindRange(BATCH_VISIBLE_BINDING);
+		glNamedBufferSubData(commandBuffer, 0, commands.size() * sizeof(DrawElementsIndirectCommand), commands.data());
+	}
+
+	// Depois do desenho que usou a lista deste frame
+	void endFrame() { visibleRing.endFrame(); }
+
+	bool active() const { return visibleRing.id() != 0; }
+	SimdPath simdPath() const { return path; }
+	size_t objects() const { return spheres.size(); }
+	size_t visibleCount() const { return lastVisible; }
+
+private:
+	SphereArrays spheres;
+	std::vector<uint8_t> mask;
+	std::vector<DrawElementsIndirectCommand> sourceCommands, commands;
+	FrameRing visibleRing;
+	GLuint commandBuffer = 0;
+	unsigned threads = 0;
+	SimdPath path = SIMD_SCALAR;
+	size_t lastVisible = 0;
+};
@@ -0,0 +1,271 @@
+/* CpuProfiler.h - zonas de tempo de CPU por thread, exportadas no formato Chrome Trace
+ *
+ * Uma ProfileZone mede do construtor ao destrutor e grava um evento (nome,
+ * começo, fim) no buffer do thread atual. Cada thread tem o seu buffer (criado
+ * no primeiro evento), então gravar não tem trava nem atomic de leitura e
+ * escrita: são duas leituras do relógio e alguns stores (medido com
+ * measureOverhead()). Com o profiler desligado a zona só lê uma flag.
+ *
+ * O relógio, no x86, é o contador de ciclos (rdtsc), bem mais barato que o
+ * steady_clock; na exportação ele é convertido para tempo comparando o
+ * contador e o steady_clock do começo e do fim. Em outras arquiteturas as
+ * zonas usam o steady_clock direto.
+ *
+ * O buffer é um anel de PROFILE_EVENTS_PER_THREAD eventos: guarda os mais
+ * recentes. writeTrace() pode ser chamado com os outros threads gravando:
+ * quem escreve avisa (writing) antes de sobrescrever uma posição e publica
+ * (written) depois, como um seqlock; quem lê copia os eventos publicados e
+ * descarta os que foram sobrescritos durante a cópia.
+ *
+ * O arquivo é o JSON do Trace Event Format (eventos "X" com ts/dur em
+ * microssegundos, um tid por thread com o nome dele), aberto em
+ * chrome://tracing ou em ui.perfetto.dev.
+ *
+ * Os nomes das zonas precisam continuar vivos até a exportação (literais).
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define PROFILER_RDTSC 1
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define PROFILER_RDTSC 1
+#endif
+
+// Eventos guardados por thread (os mais antigos são sobrescritos); potência de 2
+const size_t PROFILE_EVENTS_PER_THREAD = 1 << 16;
+
+class CpuProfiler
+{
+public:
+	CpuProfiler() : origin(now()), originNs(steadyNs()) {}
+
+	// Relógio das zonas: ciclos (rdtsc) ou nanossegundos (steady_clock)
+	static uint64_t now()
+	{
+#ifdef PROFILER_RDTSC
+		return __rdtsc();
+#else
+		return steadyNs();
+#endif
+	}
+
+	static uint64_t steadyNs()
+	{
+		return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+	// Nanossegundos por unidade de now(), desde a criação do profiler
+	double nanosecondsPerTick() const
+	{
+#ifdef PROFILER_RDTSC
+		const uint64_t ticks = now() - origin, ns = steadyNs() - originNs;
+		return ticks > 0 && ns > 0 ? (double)ns / ticks : 1.0;
+#else
+		return 1.0;
+#endif
+	}
+
+	void enable(bool on = true) { active.store(on, std::memory_order_relaxed); }
+	bool enabled() const { return active.load(std::memory_order_relaxed); }
+
+	// Nome do thread atual no arquivo (vale para o buffer criado depois)
+	void setThreadName(const std::string &name)
+	{
+		threadName() = name;
+		if (ThreadBuffer *buffer = currentBuffer())
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			buffer->name = name;
+		}
+	}
+
+	void record(const char *name, uint64_t start, uint64_t end)
+	{
+		ThreadBuffer *buffer = currentBuffer();
+		if (!buffer)
+			buffer = createBuffer();
+		const uint64_t index = buffer->written.load(std::memory_order_relaxed);
+		buffer->writing.store(index + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		Event &event = buffer->events[index & (PROFILE_EVENTS_PER_THREAD - 1)];
+		event.name.store(name, std::memory_order_relaxed);
+		event.start.store(start, std::memory_order_relaxed);
+		event.end.store(end, std::memory_order_relaxed);
+		buffer->written.store(index + 1, std::memory_order_release);
+	}
+
+	// Custo médio de uma zona vazia, em ns (grava e depois apaga os eventos
+	// deste thread: chamar antes de medir qualquer coisa)
+	double measureOverhead(unsigned zones = 10000);
+
+	// Grava os eventos de todos os threads; false se o arquivo não abriu
+	bool writeTrace(const std::string &path)
+	{
+		std::ofstream out(path);
+		if (!out)
+		{
+			std::cout << "ERROR::PROFILER::CANNOT_WRITE " << path << std::endl;
+			return false;
+		}
+		out << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+		out << "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 1, \"args\": {\"name\": \"Hello3D\"}}";
+		char line[256];
+		const double scale = nanosecondsPerTick() / 1000.0; // em microssegundos
+		std::lock_guard<std::mutex> lock(mutex);
+		for (size_t tid = 0; tid < buffers.size(); tid++)
+		{
+			ThreadBuffer &buffer = *buffers[tid];
+			out << ",\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << tid << ", \"args\": {\"name\": \"" << buffer.name << "\"}}";
+
+			// Cópia dos publicados; depois, fora os sobrescritos durante a cópia
+			const uint64_t written = buffer.written.load(std::memory_order_acquire);
+			const uint64_t first = written > PROFILE_EVENTS_PER_THREAD ? written - PROFILE_EVENTS_PER_THREAD : 0;
+			std::vector<Copy> copies;
+			copies.reserve(written - first);
+			for (uint64_t i = first; i < written; i++)
+			{
+				const Event &event = buffer.events[i & (PROFILE_EVENTS_PER_THREAD - 1)];
+				copies.push_back({i, event.name.load(std::memory_order_relaxed), event.start.load(std::memory_order_relaxed),
+													event.end.load(std::memory_order_relaxed)});
+			}
+			std::atomic_thread_fence(std::memory_order_acquire);
+			const uint64_t writing = buffer.writing.load(std::memory_order_relaxed);
+			const uint64_t valid = writing > PROFILE_EVENTS_PER_THREAD ? writing - PROFILE_EVENTS_PER_THREAD : 0;
+			for (const Copy &copy : copies)
+			{
+				if (copy.index < valid || !copy.name)
+					continue;
+				snprintf(line, sizeof(line), ",\n{\"name\": \"%s\", \"ph\": \"X\", \"pid\": 1, \"tid\": %zu, \"ts\": %.3f, \"dur\": %.3f}",
+								 copy.name, tid, (double)(copy.start - origin) * scale, (double)(copy.end - copy.start) * scale);
+				out << line;
+			}
+		}
+		out << "\n]}\n";
+		return (bool)out;
+	}
+
+private:
+	struct Event
+	{
+		std::atomic<const char *> name{nullptr};
+		std::atomic<uint64_t> start{0}, end{0};
+	};
+
+	struct ThreadBuffer
+	{
+		std::string name;
+		std::atomic<uint64_t> writing{0}; // posição sendo escrita + 1 (avisada antes)
+		std::atomic<uint64_t> written{0}; // eventos publicados
+		Event events[PROFILE_EVENTS_PER_THREAD];
+	};
+
+	struct Copy
+	{
+		uint64_t index;
+		const char *name;
+		uint64_t start, end;
+	};
+
+	// Um profiler só no programa (cpuProfiler()), então um buffer por thread basta
+	static ThreadBuffer *&currentBuffer()
+	{
+		static thread_local ThreadBuffer *buffer = nullptr;
+		return buffer;
+	}
+	static std::string &threadName()
+	{
+		static thread_local std::string name;
+		return name;
+	}
+
+	// Os buffers ficam até o fim do programa (os eventos de um thread que
+	// terminou ainda vão para o arquivo)
+	ThreadBuffer *createBuffer()
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		buffers.push_back(std::make_unique<ThreadBuffer>());
+		ThreadBuffer *buffer = buffers.back().get();
+		buffer->name = threadName().empty() ? "thread " + std::to_string(buffers.size() - 1) : threadName();
+		currentBuffer() = buffer;
+		return buffer;
+	}
+
+	const uint64_t origin, originNs;
+	std::atomic<bool> active{false};
+	std::mutex mutex; // lista de buffers e nomes (só na criação e na exportação)
+	std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+};
+
+inline CpuProfiler &cpuProfiler()
+{
+	static CpuProfiler profiler;
+	return profiler;
+}
+
+// Mede o escopo onde foi declarada (ou até end()): ProfileZone zone("nome");
+class ProfileZone
+{
+public:
+	explicit ProfileZone(const char *name)
+			: name(name), start(cpuProfiler().enabled() ? CpuProfiler::now() : 0) {}
+	~ProfileZone() { end(); }
+
+	// Fecha a zona antes do fim do escopo
+	void end()
+	{
+		if (start)
+			cpuProfiler().record(name, start, CpuProfiler::now());
+		start = 0;
+	}
+
+	ProfileZone(const ProfileZone &) = delete;
+	ProfileZone &operator=(const ProfileZone &) = delete;
+
+private:
+	const char *name;
+	uint64_t start;
+};
+
+inline double CpuProfiler::measureOverhead(unsigned zones)
+{
+	const bool wasEnabled = enabled();
+	enable();
+	// O buffer do thread é criado (e a memória dele tocada) fora da medida
+	if (!currentBuffer())
+		createBuffer();
+	// Menor de algumas rodadas: uma interrupção no meio não conta
+	uint64_t best = ~(uint64_t)0;
+	for (int round = 0; round < 4; round++)
+	{
+		const uint64_t start = now();
+		for (unsigned i = 0; i < zones; i++)
+		{
+			ProfileZone zone("medida");
+		}
+		best = std::min(best, now() - start);
+	}
+	enable(wasEnabled);
+
+	// Só este thread escreve no próprio buffer: pode zerar sem corrida
+	ThreadBuffer *buffer = currentBuffer();
+	for (Event &event : buffer->events)
+		event.name.store(nullptr, std::memory_order_relaxed);
+	buffer->writing.store(0, std::memory_order_relaxed);
+	buffer->written.store(0, std::memory_order_release);
+	return best * nanosecondsPerTick() / zones;
+}
@@ -0,0 +1,279 @@
+/* FrameBenchmark.h - medição reprodutível de frames (--bench)
+ *
+ * Para comparar dois builds, duas execuções precisam desenhar exatamente os
+ * mesmos frames: no modo benchmark a animação anda por um passo fixo por frame
+ * (time(frame)) em vez do relógio, os shaders são compilados antes do
+ * primeiro frame e os primeiros frames (aquecimento) não entram na conta.
+ *
+ * Por frame medido são guardados:
+ *  - tempo de CPU: intervalo entre o começo deste frame e o do seguinte
+ *    (inclui a troca de buffers / espera pela GPU);
+ *  - tempo de GPU: consulta GL_TIME_ELAPSED em volta dos comandos do frame,
+ *    lida alguns frames depois (anel de BENCHMARK_QUERIES consultas);
+ *  - chamadas de desenho e chamadas de estado que foram para a OpenGL.
+ *
+ * O resumo (média, p50, p95, p99 e máximo) vai para o terminal e, se pedido,
+ * para JSON (resumo + configuração) e CSV (um frame por linha).
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+
+// Consultas de tempo em voo; a de BENCHMARK_QUERIES frames atrás já terminou
+const unsigned BENCHMARK_QUERIES = 8;
+
+struct FrameSample
+{
+	double cpuMs = 0.0;
+	double gpuMs = -1.0; // < 0: sem consulta de tempo
+	uint32_t drawCalls = 0;
+	uint32_t stateCalls = 0;
+};
+
+struct FrameStatistics
+{
+	double mean = 0.0, p50 = 0.0, p95 = 0.0, p99 = 0.0, max = 0.0;
+};
+
+// Percentis pelo posto mais próximo (sem interpolar: sempre um valor medido)
+inline FrameStatistics frameStatistics(std::vector<double> values)
+{
+	FrameStatistics stats;
+	if (values.empty())
+		return stats;
+	std::sort(values.begin(), values.end());
+	auto percentile = [&](double p)
+	{
+		size_t rank = (size_t)std::ceil(p / 100.0 * values.size());
+		return values[std::min(values.size(), std::max<size_t>(rank, 1)) - 1];
+	};
+	for (double v : values)
+		stats.mean += v;
+	stats.mean /= values.size();
+	stats.p50 = percentile(50);
+	stats.p95 = percentile(95);
+	stats.p99 = percentile(99);
+	stats.max = values.back();
+	return stats;
+}
+
+class FrameBenchmark
+{
+public:
+	~FrameBenchmark() { destroy(); }
+
+	// warmup frames descartados, depois frames medidos; timestep em segundos
+	void create(size_t warmup, size_t frames, double timestep)
+	{
+		destroy();
+		warmupFrames = warmup;
+		measuredFrames = frames;
+		step = timestep;
+		samples.clear();
+		samples.reserve(frames);
+		glCreateQueries(GL_TIME_ELAPSED, BENCHMARK_QUERIES, queries);
+		for (size_t &sample : querySample)
+			sample = NO_SAMPLE;
+	}
+
+	void destroy()
+	{
+		if (queries[0])
+			glDeleteQueries(BENCHMARK_QUERIES, queries);
+		for (GLuint &query : queries)
+			query = 0;
+	}
+
+	size_t totalFrames() const { return warmupFrames + measuredFrames; }
+	bool measuring(size_t frame) const { return frame >= warmupFrames; }
+	// Tempo simulado do frame: o mesmo em qualquer máquina e execução
+	double time(size_t frame) const { return frame * step; }
+
+	// Começo de um frame medido (antes de qualquer comando do frame)
+	void beginFrame()
+	{
+		const auto now = std::chrono::steady_clock::now();
+		if (open)
+			samples.back().cpuMs = std::chrono::duration<double, std::milli>(now - frameStart).count();
+		frameStart = now;
+		open = true;
+		samples.emplace_back();
+
+		const unsigned slot = (unsigned)((samples.size() - 1) % BENCHMARK_QUERIES);
+		collect(slot);
+		glBeginQuery(GL_TIME_ELAPSED, queries[slot]);
+		querySample[slot] = samples.size() - 1;
+	}
+
+	// Fim dos comandos do frame (antes da troca de buffers)
+	void endFrame(uint32_t drawCalls, uint32_t stateCalls)
+	{
+		glEndQuery(GL_TIME_ELAPSED);
+		samples.back().drawCalls = drawCalls;
+		samples.back().stateCalls = stateCalls;
+	}
+
+	// Depois do último frame: fecha o tempo dele e lê as consultas restantes
+	void finish()
+	{
+		if (open)
+			samples.back().cpuMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - frameStart).count();
+		open = false;
+		for (unsigned slot = 0; slot < BENCHMARK_QUERIES; slot++)
+			collect(slot);
+	}
+
+	const std::vector<FrameSample> &frameSamples() const { return samples; }
+
+	FrameStatistics cpu() const
+	{
+		return statistics([](const FrameSample &s)
+											{ return s.cpuMs; });
+	}
+	FrameStatistics gpu() const
+	{
+		return statistics([](const FrameSample &s)
+											{ return s.gpuMs; });
+	}
+	FrameStatistics drawCalls() const
+	{
+		return statistics([](const FrameSample &s)
+											{ return (double)s.drawCalls; });
+	}
+	FrameStatistics stateCalls() const
+	{
+		return statistics([](const FrameSample &s)
+											{ return (double)s.stateCalls; });
+	}
+
+	void print() const
+	{
+		auto line = [](const char *name, const FrameStatistics &s, const char *unit)
+		{
+			std::cout << "  " << name << ": media " << s.mean << unit << ", p50 " << s.p50 << unit << ", p95 " << s.p95 << unit
+								<< ", p99 " << s.p99 << unit << ", max " << s.max << unit << std::endl;
+		};
+		std::cout << "Benchmark: " << samples.size() << " frames medidos (" << warmupFrames << " de aquecimento), passo fixo de "
+							<< step * 1000.0 << " ms" << std::endl;
+		line("CPU", cpu(), " ms");
+		if (hasGpuTimes())
+			line("GPU", gpu(), " ms");
+		line("draw calls", drawCalls(), "");
+		line("chamadas de estado", stateCalls(), "");
+	}
+
+	// info: pares nome/valor da configuração (renderer, argumentos, ...)
+	bool writeJson(const std::string &path, const std::vector<std::pair<std::string, std::string>> &info) const
+	{
+		std::ofstream out(path);
+		if (!out)
+		{
+			std::cout << "ERROR::BENCHMARK::CANNOT_WRITE " << path << std::endl;
+			return false;
+		}
+		auto statistics = [&](const char *name, const FrameStatistics &s, bool last)
+		{
+			out << "  \"" << name << "\": {\"mean\": " << s.mean << ", \"p50\": " << s.p50 << ", \"p95\": " << s.p95 << ", \"p99\": " << s.p99
+					<< ", \"max\": " << s.max << "}" << (last ? "\n" : ",\n");
+		};
+		out << "{\n";
+		for (const auto &entry : info)
+			out << "  \"" << jsonEscape(entry.first) << "\": \"" << jsonEscape(entry.second) << "\",\n";
+		out << "  \"warmup_frames\": " << warmupFrames << ",\n";
+		out << "  \"frames\": " << samples.size() << ",\n";
+		out << "  \"timestep_ms\": " << step * 1000.0 << ",\n";
+		statistics("cpu_ms", cpu(), false);
+		if (hasGpuTimes())
+			statistics("gpu_ms", gpu(), false);
+		else
+			out << "  \"gpu_ms\": null,\n";
+		statistics("draw_calls", drawCalls(), false);
+		statistics("state_calls", stateCalls(), true);
+		out << "}\n";
+		return (bool)out;
+	}
+
+	bool writeCsv(const std::string &path) const
+	{
+		std::ofstream out(path);
+		if (!out)
+		{
+			std::cout << "ERROR::BENCHMARK::CANNOT_WRITE " << path << std::endl;
+			return false;
+		}
+		out << "frame,cpu_ms,gpu_ms,draw_calls,state_calls\n";
+		for (size_t i = 0; i < samples.size(); i++)
+		{
+			const FrameSample &s = samples[i];
+			out << warmupFrames + i << "," << s.cpuMs << ",";
+			if (s.gpuMs >= 0.0)
+				out << s.gpuMs;
+			out << "," << s.drawCalls << "," << s.stateCalls << "\n";
+		}
+		return (bool)out;
+	}
+
+private:
+	static const size_t NO_SAMPLE = ~(size_t)0;
+
+	// Lê a consulta da posição (espera se ainda não terminou) para a amostra dela
+	void collect(unsigned slot)
+	{
+		if (querySample[slot] == NO_SAMPLE)
+			return;
+		GLuint64 nanoseconds = 0;
+		glGetQueryObjectui64v(queries[slot], GL_QUERY_RESULT, &nanoseconds);
+		samples[querySample[slot]].gpuMs = nanoseconds / 1e6;
+		querySample[slot] = NO_SAMPLE;
+	}
+
+	bool hasGpuTimes() const
+	{
+		for (const FrameSample &s : samples)
+			if (s.gpuMs >= 0.0)
+				return true;
+		return false;
+	}
+
+	template <typename Value>
+	FrameStatistics statistics(Value value) const
+	{
+		std::vector<double> values;
+		values.reserve(samples.size());
+		for (const FrameSample &s : samples)
+			if (value(s) >= 0.0)
+				values.push_back(value(s));
+		return frameStatistics(values);
+	}
+
+	static std::string jsonEscape(const std::string &text)
+	{
+		std::string escaped;
+		for (char c : text)
+		{
+			if (c == '"' || c == '\\')
+				escaped += '\\';
+			if ((unsigned char)c >= 0x20)
+				escaped += c;
+		}
+		return escaped;
+	}
+
+	size_t warmupFrames = 0, measuredFrames = 0;
+	double step = 1.0 / 60.0;
+	std::vector<FrameSample> samples;
+	std::chrono::steady_clock::time_point frameStart;
+	bool open = false;
+	GLuint queries[BENCHMARK_QUERIES] = {};
+	size_t querySample[BENCHMARK_QUERIES] = {}; // amostra medida por cada consulta
+};
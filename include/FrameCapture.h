@@ -0,0 +1,416 @@
+/* FrameCapture.h - gravação dos frames (PNG ou vídeo Y4M) sem parar o loop
+ *
+ * Um glReadPixels para a memória da CPU espera a GPU terminar o frame (e
+ * todos os anteriores) antes de voltar: com ele a cada frame, a CPU e a GPU
+ * deixam de trabalhar ao mesmo tempo. Aqui o glReadPixels vai para um pixel
+ * pack buffer (PBO), o que só enfileira a cópia na GPU, e uma cerca marca o
+ * ponto. Os PBOs formam um anel de CAPTURE_BUFFERS: o frame só é lido da
+ * memória mapeada quando a cerca dele já passou (normalmente alguns frames
+ * depois); a CPU só espera se a GPU estiver mais de CAPTURE_BUFFERS frames
+ * atrasada.
+ *
+ * Codificar um PNG leva muito mais que um frame, então os pixels lidos vão
+ * para um grupo de threads escritores (até CAPTURE_MAX_WRITERS, cada um
+ * codificando um frame), numa fila de até CAPTURE_QUEUE_FRAMES frames
+ * (buffers reaproveitados). Se os escritores ficarem para trás e a fila
+ * encher, o frame é descartado (e contado) para não derrubar a taxa de
+ * quadros da janela. Com lossless o loop espera a fila em vez de descartar:
+ * a gravação fica completa, para servir de referência em testes de
+ * regressão. Descartes e esperas ficam em FrameCaptureStats.
+ *
+ * Formatos: caminho terminado em .y4m grava um vídeo YUV4MPEG2 sem compressão
+ * (4:4:4, BT.601) num arquivo só; qualquer outro caminho é o prefixo dos PNGs
+ * (prefixo_000000.png, ..., numerados pelo frame, então um descarte deixa um
+ * buraco), codificados pela stb_image_write. No vídeo os escritores
+ * convertem em paralelo e gravam no arquivo na ordem dos frames.
+ *
+ * Limitação: o tamanho é fixado em create(); se a janela mudar de tamanho, a
+ * captura continua lendo o retângulo original.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <glad/glad.h>
+#include <stb_image_write.h>
+
+#include <Capabilities.h>
+#include <CpuProfiler.h>
+#include <JobSystem.h>
+#include <RenderState.h>
+
+// PBOs no anel: o frame é lido até CAPTURE_BUFFERS frames depois da cópia
+const unsigned CAPTURE_BUFFERS = 3;
+// Frames lidos esperando os threads escritores (incluindo os sendo gravados)
+const size_t CAPTURE_QUEUE_FRAMES = 8;
+// Threads escritores no máximo (um por núcleo além do principal)
+const unsigned CAPTURE_MAX_WRITERS = 4;
+
+struct FrameCaptureStats
+{
+	unsigned frames = 0;				 // frames entregues aos escritores
+	unsigned dropped = 0;				 // descartados com a fila cheia (sem lossless)
+	unsigned gpuWaits = 0;			 // o PBO ainda não tinha sido preenchido pela GPU
+	double gpuWaitSeconds = 0.0;
+	unsigned writerWaits = 0; // a fila dos escritores estava cheia (com lossless)
+	double writerWaitSeconds = 0.0;
+	double copySeconds = 0.0; // cópia do PBO mapeado para a fila
+};
+
+class FrameCapture
+{
+public:
+	~FrameCapture()
+	{
+		stopWriters();
+		destroy();
+	}
+
+	// path: vídeo .y4m ou prefixo dos PNGs; lossless: espera os escritores em
+	// vez de descartar frames; fps só vai no cabeçalho do vídeo
+	bool create(const std::string &path, GLsizei width, GLsizei height, bool lossless = false, unsigned fps = 60)
+	{
+		stopWriters();
+		destroy();
+		this->path = path;
+		this->lossless = lossless;
+		writeFailed = false;
+		captureWidth = width;
+		captureHeight = height;
+		frameBytes = (size_t)width * height * 4;
+		video = path.size() > 4 && path.compare(path.size() - 4, 4, ".y4m") == 0;
+		if (video)
+		{
+			file = fopen(path.c_str(), "wb");
+			if (!file)
+			{
+				std::cout << "ERROR::CAPTURE::CANNOT_WRITE " << path << std::endl;
+				return false;
+			}
+			fprintf(file, "YUV4MPEG2 W%d H%d F%u:1 Ip A1:1 C444\n", width, height, fps);
+		}
+		// A OpenGL lê de baixo para cima; PNG e Y4M são de cima para baixo
+		stbi_flip_vertically_on_write(1);
+
+		for (Slot &slot : slots)
+		{
+			glCreateBuffers(1, &slot.buffer);
+			if (capabilities().bufferStorage)
+			{
+				const GLbitfield flags = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+				glNamedBufferStorage(slot.buffer, frameBytes, nullptr, flags);
+				slot.mapped = (const uint8_t *)glMapNamedBufferRange(slot.buffer, 0, frameBytes, flags);
+			}
+			else
+			{
+				glNamedBufferData(slot.buffer, frameBytes, nullptr, GL_STREAM_READ);
+			}
+		}
+
+		// O loop de desenho fica com um núcleo; os outros codificam
+		const unsigned writerCount = std::max(1u, std::min(CAPTURE_MAX_WRITERS, workerThreadCount() - 1));
+		running = true;
+		for (unsigned i = 0; i < writerCount; i++)
+			writers.emplace_back([this, i]()
+													 { writerLoop(i); });
+		return true;
+	}
+
+	unsigned writerCount() const { return (unsigned)writers.size(); }
+	bool isLossless() const { return lossless; }
+
+	// Depois do desenho (e da cópia para a janela), antes da troca de buffers:
+	// enfileira a cópia do framebuffer para o próximo PBO do anel
+	void capture(GLuint framebuffer)
+	{
+		if (!active())
+			return;
+		ProfileZone zone("captura");
+		// Os frames que a GPU já terminou vão para o escritor, na ordem
+		collectReady();
+
+		Slot &slot = slots[next];
+		if (slot.fence)
+		{
+			// A GPU está CAPTURE_BUFFERS frames atrás: espera a cópia mais antiga
+			auto start = std::chrono::steady_clock::now();
+			GLenum result = glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+			if (result == GL_TIMEOUT_EXPIRED)
+			{
+				stats.gpuWaits++;
+				while (result == GL_TIMEOUT_EXPIRED)
+					result = glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000); // 1 ms
+				stats.gpuWaitSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			}
+			collect(slot);
+		}
+
+		RenderState &state = renderState();
+		state.bindFramebuffer(framebuffer);
+		state.bindBuffer(GL_PIXEL_PACK_BUFFER, slot.buffer);
+		glReadPixels(0, 0, captureWidth, captureHeight, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+		// Sem PBO ligado, glReadPixels de outros lugares volta a ler para a CPU
+		state.bindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		next = (next + 1) % CAPTURE_BUFFERS;
+	}
+
+	// Depois do último frame: lê as cópias em voo, espera o escritor terminar
+	void finish()
+	{
+		if (!active())
+			return;
+		for (unsigned i = 0; i < CAPTURE_BUFFERS; i++)
+		{
+			Slot &slot = slots[(next + i) % CAPTURE_BUFFERS];
+			if (!slot.fence)
+				continue;
+			glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, ~0ull);
+			collect(slot);
+		}
+		stopWriters();
+		destroy();
+	}
+
+	void destroy()
+	{
+		for (Slot &slot : slots)
+		{
+			if (slot.fence)
+				glDeleteSync(slot.fence);
+			if (slot.buffer)
+			{
+				if (slot.mapped)
+					glUnmapNamedBuffer(slot.buffer);
+				glDeleteBuffers(1, &slot.buffer);
+			}
+			slot = Slot();
+		}
+		if (file)
+			fclose(file);
+		file = nullptr;
+		next = 0;
+		captured = 0;
+		queued = 0;
+		fileTurn = 0;
+	}
+
+	bool active() const { return slots[0].buffer != 0; }
+	const FrameCaptureStats &captureStats() const { return stats; }
+	const std::string &capturePath() const { return path; }
+	bool isVideo() const { return video; }
+
+private:
+	struct Slot
+	{
+		GLuint buffer = 0;
+		const uint8_t *mapped = nullptr; // mapeamento persistente (ou nullptr)
+		GLsync fence = nullptr;					 // cópia do framebuffer enfileirada
+	};
+
+	struct Pending
+	{
+		unsigned frame;		 // frame capturado (nome do PNG)
+		unsigned sequence; // ordem na fila (ordem no vídeo)
+		std::vector<uint8_t> pixels;
+	};
+
+	// Entrega ao escritor, a partir do mais antigo, os PBOs cuja cópia terminou
+	void collectReady()
+	{
+		for (unsigned i = 0; i < CAPTURE_BUFFERS; i++)
+		{
+			Slot &slot = slots[(next + i) % CAPTURE_BUFFERS];
+			if (!slot.fence)
+				continue;
+			if (glClientWaitSync(slot.fence, 0, 0) == GL_TIMEOUT_EXPIRED)
+				return;
+			collect(slot);
+		}
+	}
+
+	// Copia o PBO (cópia já terminada) para um buffer da fila dos escritores
+	void collect(Slot &slot)
+	{
+		glDeleteSync(slot.fence);
+		slot.fence = nullptr;
+
+		Pending pending;
+		pending.frame = captured++;
+		{
+			// Buffer livre, ou novo enquanto a fila não chegou no limite
+			auto start = std::chrono::steady_clock::now();
+			std::unique_lock<std::mutex> lock(mutex);
+			if (spare.empty() && allocated == CAPTURE_QUEUE_FRAMES)
+			{
+				if (!lossless)
+				{
+					// Escritores atrasados: o frame fica de fora, o loop não para
+					stats.dropped++;
+					return;
+				}
+				stats.writerWaits++;
+				changed.wait(lock, [this]()
+										 { return !spare.empty(); });
+				stats.writerWaitSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			}
+			if (!spare.empty())
+			{
+				pending.pixels.swap(spare.back());
+				spare.pop_back();
+			}
+			else
+			{
+				allocated++;
+			}
+		}
+
+		auto start = std::chrono::steady_clock::now();
+		pending.pixels.resize(frameBytes);
+		if (slot.mapped)
+		{
+			memcpy(pending.pixels.data(), slot.mapped, frameBytes);
+		}
+		else
+		{
+			const void *mapped = glMapNamedBufferRange(slot.buffer, 0, frameBytes, GL_MAP_READ_BIT);
+			if (mapped)
+				memcpy(pending.pixels.data(), mapped, frameBytes);
+			glUnmapNamedBuffer(slot.buffer);
+		}
+		stats.copySeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		stats.frames++;
+		pending.sequence = queued++;
+
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			queue.push_back(std::move(pending));
+		}
+		changed.notify_all();
+	}
+
+	void writerLoop(unsigned index)
+	{
+		cpuProfiler().setThreadName("captura " + std::to_string(index));
+		std::vector<uint8_t> planes; // Y, U e V do frame, no vídeo
+		while (true)
+		{
+			Pending pending;
+			{
+				std::unique_lock<std::mutex> lock(mutex);
+				changed.wait(lock, [this]()
+										 { return !queue.empty() || !running; });
+				if (queue.empty())
+					return;
+				pending = std::move(queue.front());
+				queue.pop_front();
+			}
+			write(pending, planes);
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				spare.push_back(std::move(pending.pixels));
+			}
+			changed.notify_all();
+		}
+	}
+
+	// Num thread escritor (vários ao mesmo tempo, cada um com o seu frame)
+	void write(Pending &pending, std::vector<uint8_t> &planes)
+	{
+		ProfileZone zone("gravar frame");
+		uint8_t *pixels = pending.pixels.data();
+		const size_t count = (size_t)captureWidth * captureHeight;
+		if (video)
+		{
+			// RGBA -> Y, U, V (planos completos, BT.601 de faixa limitada), de cima para baixo
+			planes.resize(count * 3);
+			uint8_t *y = planes.data(), *u = y + count, *v = u + count;
+			for (GLsizei row = 0; row < captureHeight; row++)
+			{
+				const uint8_t *p = pixels + (size_t)(captureHeight - 1 - row) * captureWidth * 4;
+				const size_t out = (size_t)row * captureWidth;
+				for (GLsizei x = 0; x < captureWidth; x++, p += 4)
+				{
+					const int r = p[0], g = p[1], b = p[2];
+					y[out + x] = (uint8_t)(((66 * r + 129 * g + 25 * b + 128) >> 8) + 16);
+					u[out + x] = (uint8_t)(((-38 * r - 74 * g + 112 * b + 128) >> 8) + 128);
+					v[out + x] = (uint8_t)(((112 * r - 94 * g - 18 * b + 128) >> 8) + 128);
+				}
+			}
+			// Cada frame espera a vez dele no arquivo
+			std::unique_lock<std::mutex> lock(fileMutex);
+			fileChanged.wait(lock, [this, &pending]()
+											 { return fileTurn == pending.sequence; });
+			fputs("FRAME\n", file);
+			if (fwrite(planes.data(), 1, planes.size(), file) != planes.size() && !writeFailed.exchange(true))
+				std::cout << "ERROR::CAPTURE::CANNOT_WRITE " << path << std::endl;
+			fileTurn++;
+			lock.unlock();
+			fileChanged.notify_all();
+			return;
+		}
+
+		// PNG sem alfa (o alfa do framebuffer não é a opacidade da imagem)
+		for (size_t i = 0; i < count; i++)
+			memmove(pixels + i * 3, pixels + i * 4, 3);
+		char number[16];
+		snprintf(number, sizeof(number), "_%06u.png", pending.frame);
+		const std::string name = path + number;
+		if (!stbi_write_png(name.c_str(), captureWidth, captureHeight, 3, pixels, captureWidth * 3) && !writeFailed.exchange(true))
+			std::cout << "ERROR::CAPTURE::CANNOT_WRITE " << name << std::endl;
+	}
+
+	// Os escritores esvaziam a fila antes de sair
+	void stopWriters()
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			running = false;
+		}
+		changed.notify_all();
+		for (std::thread &writer : writers)
+			writer.join();
+		writers.clear();
+	}
+
+	std::string path;
+	GLsizei captureWidth = 0, captureHeight = 0;
+	size_t frameBytes = 0;
+	bool video = false;
+	bool lossless = false;
+	FILE *file = nullptr;
+
+	Slot slots[CAPTURE_BUFFERS];
+	unsigned next = 0;		 // próximo PBO a receber uma cópia (o mais antigo em voo)
+	unsigned captured = 0; // frames lidos dos PBOs (entregues ou descartados)
+	unsigned queued = 0;	 // frames entregues aos escritores
+	FrameCaptureStats stats;
+
+	// Fila dos escritores (protegida por mutex)
+	std::vector<std::thread> writers;
+	std::mutex mutex;
+	std::condition_variable changed;
+	std::deque<Pending> queue;
+	std::vector<std::vector<uint8_t>> spare; // buffers já escritos, para reaproveitar
+	size_t allocated = 0;
+	bool running = false;
+
+	// Vez de cada frame no vídeo (protegida por fileMutex)
+	std::mutex fileMutex;
+	std::condition_variable fileChanged;
+	unsigned fileTurn = 0;
+	std::atomic<bool> writeFailed{false};
+};
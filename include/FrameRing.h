@@ -0,0 +1,162 @@
+/* FrameRing.h - buffer circular por frame, mapeado de forma persistente
+ *
+ * Um único buffer é dividido em N regiões (frames "em voo"). A cada frame a CPU
+ * escreve os dados (por exemplo, as matrizes das instâncias) direto na região
+ * atual, que fica mapeada o tempo todo (ARB_buffer_storage, GL 4.4), sem
+ * glBufferSubData e sem cópias do driver. Depois dos draw calls que usam a
+ * região, um glFenceSync marca o ponto; quando a região volta a ser usada N
+ * frames depois, glClientWaitSync garante que a GPU já terminou de lê-la.
+ *
+ * Se a GPU estiver atrasada a CPU espera nesse ponto; o tempo de espera é
+ * acumulado em FrameRingStats.
+ *
+ * Sem ARB_buffer_storage o buffer é mapeado a cada frame com
+ * GL_MAP_UNSYNCHRONIZED_BIT (as mesmas cercas fazem a sincronização).
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+
+#include <glad/glad.h>
+
+#include <Capabilities.h>
+#include <RenderState.h>
+
+const unsigned MAX_FRAMES_IN_FLIGHT = 8;
+
+struct FrameRingStats
+{
+	unsigned frames = 0;
+	unsigned waits = 0;				// frames em que a CPU teve que esperar a GPU
+	double stallSeconds = 0.0; // tempo total esperando
+	double maxStallSeconds = 0.0;
+};
+
+class FrameRing
+{
+public:
+	~FrameRing() { destroy(); }
+
+	// target: GL_SHADER_STORAGE_BUFFER, GL_UNIFORM_BUFFER ou GL_ARRAY_BUFFER.
+	// Cada região tem pelo menos regionBytes, arredondado para o alinhamento
+	// exigido pelo target.
+	bool create(GLenum target, size_t regionBytes, unsigned regionCount)
+	{
+		destroy();
+		this->target = target;
+		count = std::max(1u, std::min(regionCount, MAX_FRAMES_IN_FLIGHT));
+
+		GLint alignment = 256;
+		if (target == GL_SHADER_STORAGE_BUFFER)
+			glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+		else if (target == GL_UNIFORM_BUFFER)
+			glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &alignment);
+		alignment = std::max(alignment, 64); // pelo menos uma linha de cache da CPU
+		stride = (regionBytes + alignment - 1) / alignment * alignment;
+		size = regionBytes;
+
+		glCreateBuffers(1, &buffer);
+		if (capabilities().bufferStorage)
+		{
+			const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+			glNamedBufferStorage(buffer, stride * count, nullptr, flags);
+			mapped = (uint8_t *)glMapNamedBufferRange(buffer, 0, stride * count, flags);
+			persistentMapping = mapped != nullptr;
+		}
+		else
+		{
+			glNamedBufferData(buffer, stride * count, nullptr, GL_STREAM_DRAW);
+		}
+		return true;
+	}
+
+	void destroy()
+	{
+		for (GLsync &fence : fences)
+		{
+			if (fence)
+				glDeleteSync(fence);
+			fence = nullptr;
+		}
+		if (buffer)
+		{
+			if (persistentMapping)
+				glUnmapNamedBuffer(buffer);
+			glDeleteBuffers(1, &buffer);
+		}
+		buffer = 0;
+		mapped = nullptr;
+		persistentMapping = false;
+		current = 0;
+	}
+
+	// Espera a GPU liberar a região atual e devolve o ponteiro para escrita
+	void *beginFrame()
+	{
+		GLsync &fence = fences[current];
+		if (fence)
+		{
+			auto start = std::chrono::steady_clock::now();
+			GLenum result = glClientWaitSync(fence, 0, 0);
+			if (result == GL_TIMEOUT_EXPIRED)
+			{
+				// A GPU ainda está lendo esta região: espera de verdade (com flush)
+				stats.waits++;
+				while (result == GL_TIMEOUT_EXPIRED)
+					result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000); // 1 ms
+				double stall = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+				stats.stallSeconds += stall;
+				stats.maxStallSeconds = std::max(stats.maxStallSeconds, stall);
+			}
+			glDeleteSync(fence);
+			fence = nullptr;
+		}
+		stats.frames++;
+
+		if (persistentMapping)
+			return mapped + current * stride;
+
+		return glMapNamedBufferRange(buffer, current * stride, size,
+																 GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT);
+	}
+
+	// Fim das escritas da CPU (antes dos draw calls que usam a região)
+	void endWrite()
+	{
+		if (persistentMapping)
+			return; // mapeamento coerente: nada a fazer
+		glUnmapNamedBuffer(buffer);
+	}
+
+	// Liga a região atual a um binding indexado (SSBO/UBO)
+	void bindRange(GLuint binding) const
+	{
+		renderState().bindBufferRange(target, binding, buffer, current * stride, size);
+	}
+
+	// Depois dos draw calls: cerca na região atual e avança para a próxima
+	void endFrame()
+	{
+		fences[current] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		current = (current + 1) % count;
+	}
+
+	GLuint id() const { return buffer; }
+	size_t currentOffset() const { return current * stride; }
+	bool persistent() const { return persistentMapping; }
+	unsigned regions() const { return count; }
+
+	FrameRingStats stats;
+
+private:
+	GLenum target = GL_SHADER_STORAGE_BUFFER;
+	GLuint buffer = 0;
+	uint8_t *mapped = nullptr;
+	bool persistentMapping = false;
+	size_t size = 0, stride = 0;
+	unsigned count = 0, current = 0;
+	GLsync fences[MAX_FRAMES_IN_FLIGHT] = {};
+};
@@ -0,0 +1,56 @@
+/* Frustum.h - planos do frustum e esferas envolventes
+ *
+ * Os 6 planos são tirados direto da matriz de projeção (clip = M * p): um ponto
+ * está dentro quando -w <= x, y, z <= w, e cada desigualdade vira um plano
+ * (linha 4 ± linha i). Com os planos normalizados, a distância do centro de
+ * uma esfera pode ser comparada com o raio.
+ */
+
+#pragma once
+
+#include <algorithm>
+
+#include <glm/glm.hpp>
+
+// Planos (a, b, c, d), com ax + by + cz + d >= 0 do lado de dentro
+inline void extractFrustumPlanes(const glm::mat4 &m, glm::vec4 planes[6])
+{
+	glm::vec4 rows[4];
+	for (int i = 0; i < 4; i++)
+		rows[i] = glm::vec4(m[0][i], m[1][i], m[2][i], m[3][i]);
+	for (int i = 0; i < 3; i++)
+	{
+		planes[i * 2] = rows[3] + rows[i];
+		planes[i * 2 + 1] = rows[3] - rows[i];
+	}
+	for (int i = 0; i < 6; i++)
+	{
+		float length = glm::length(glm::vec3(planes[i]));
+		if (length > 0.0f)
+			planes[i] = planes[i] * (1.0f / length);
+	}
+}
+
+// Esfera (centro, raio) que envolve a caixa [boundsMin, boundsMax]
+inline glm::vec4 boundingSphere(const glm::vec3 &boundsMin, const glm::vec3 &boundsMax)
+{
+	glm::vec3 center = (boundsMin + boundsMax) * 0.5f;
+	return glm::vec4(center, glm::length(boundsMax - center));
+}
+
+// Esfera levada por uma matriz de modelo (o raio cresce com a maior escala)
+inline glm::vec4 transformSphere(const glm::mat4 &m, const glm::vec4 &sphere)
+{
+	glm::vec3 center = glm::vec3(m * glm::vec4(glm::vec3(sphere), 1.0f));
+	float scale = std::max(glm::length(glm::vec3(m[0])), std::max(glm::length(glm::vec3(m[1])), glm::length(glm::vec3(m[2]))));
+	return glm::vec4(center, sphere.w * scale);
+}
+
+// Teste de referência (um objeto por vez)
+inline bool sphereInFrustum(const glm::vec4 planes[6], const glm::vec4 &sphere)
+{
+	for (int i = 0; i < 6; i++)
+		if (glm::dot(glm::vec3(planes[i]), glm::vec3(sphere)) + planes[i].w < -sphere.w)
+			return false;
+	return true;
+}
@@ -0,0 +1,391 @@
+/* GpuCulling.h - culling dos objetos do lote (MeshBatch.h) em compute shader
+ *
+ * A cada frame, antes do glMultiDrawElementsIndirect, um compute shader testa
+ * a esfera envolvente de cada objeto:
+ *  1. contra os 6 planos do frustum da matriz atual;
+ *  2. contra a pirâmide Hi-Z (profundidade máxima por bloco) do frame
+ *     anterior, projetando a esfera com a matriz do frame anterior. Se o ponto
+ *     mais próximo da esfera está atrás de tudo que já foi desenhado naquela
+ *     região da tela, o objeto está oculto.
+ * Os objetos que passam são compactados direto nos comandos indiretos: um
+ * atomicAdd no instanceCount do comando dá a posição do objeto na lista de
+ * visíveis (a partir do baseInstance do comando), que o vertex shader lê.
+ *
+ * A pirâmide Hi-Z é montada depois do desenho, a partir da textura de
+ * profundidade do RenderTarget, também em compute shader.
+ *
+ * Os contadores (visíveis, fora do frustum, ocultos) são lidos alguns frames
+ * depois, quando a cerca do frame já passou, para nunca parar a CPU.
+ *
+ * Limitação: um objeto que aparece de trás de outro por causa do movimento da
+ * câmera só é desenhado no frame seguinte (a Hi-Z é de um frame atrás).
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <Frustum.h>
+#include <MeshBatch.h>
+#include <ShaderManager.h>
+#include <RenderTarget.h>
+#include <RenderState.h>
+
+// Bindings usados pelo culling (além dos do lote, em MeshBatch.h)
+const GLuint CULL_COMMAND_BINDING = 4;
+const GLuint CULL_OBJECT_COMMAND_BINDING = 5;
+const GLuint CULL_SPHERE_BINDING = 6;
+const GLuint CULL_COUNTER_BINDING = 7;
+
+// Frames entre o culling e a leitura dos contadores
+const unsigned CULL_STATS_LATENCY = 3;
+
+const GLchar *hiZBuildShaderSource = "#version 450\n"
+																		 "layout (local_size_x = 8, local_size_y = 8) in;\n"
+																		 "layout (binding = 0) uniform sampler2D depthTexture;\n"
+																		 "layout (r32f, binding = 0) uniform readonly image2D source;\n"
+																		 "layout (r32f, binding = 1) uniform writeonly image2D destination;\n"
+																		 "uniform int level;\n"
+																		 "uniform ivec2 sourceSize;\n"
+																		 "uniform ivec2 destinationSize;\n"
+																		 "void main()\n"
+																		 "{\n"
+																		 "ivec2 p = ivec2(gl_GlobalInvocationID.xy);\n"
+																		 "if (any(greaterThanEqual(p, destinationSize)))\n"
+																		 "    return;\n"
+																		 "float depth = 0.0;\n"
+																		 "if (level == 0)\n"
+																		 "    depth = texelFetch(depthTexture, p, 0).r;\n"
+																		 "else\n"
+																		 "{\n"
+																		 // Com tamanho ímpar, o último texel também cobre a coluna/linha que sobra
+																		 "    ivec2 extent = ivec2(1);\n"
+																		 "    if (p.x == destinationSize.x - 1 && (sourceSize.x & 1) == 1) extent.x = 2;\n"
+																		 "    if (p.y == destinationSize.y - 1 && (sourceSize.y & 1) == 1) extent.y = 2;\n"
+																		 "    for (int y = 0; y <= extent.y; y++)\n"
+																		 "        for (int x = 0; x <= extent.x; x++)\n"
+																		 "            depth = max(depth, imageLoad(source, min(p * 2 + ivec2(x, y), sourceSize - 1)).r);\n"
+																		 "}\n"
+																		 "imageStore(destination, p, vec4(depth));\n"
+																		 "}\0";
+
+const GLchar *cullShaderSource = "#version 450\n"
+																 "layout (local_size_x = 64) in;\n"
+																 "struct Command { uint count; uint instanceCount; uint firstIndex; int baseVertex; uint baseInstance; };\n"
+																 "layout (std430, binding = 2) readonly buffer BatchObjects { mat4 objects[]; };\n"
+																 "layout (std430, binding = 3) writeonly buffer VisibleObjects { uint visibleObjects[]; };\n"
+																 "layout (std430, binding = 4) buffer Commands { Command commands[]; };\n"
+																 "layout (std430, binding = 5) readonly buffer ObjectCommands { uint objectCommands[]; };\n"
+																 "layout (std430, binding = 6) readonly buffer CommandSpheres { vec4 spheres[]; };\n"
+																 "layout (std430, binding = 7) buffer Counters { uint visibleCount; uint frustumCulled; uint occlusionCulled; };\n"
+																 "layout (binding = 0) uniform sampler2D hiZ;\n"
+																 "uniform uint objectCount;\n"
+																 "uniform mat4 viewProjection;\n"
+																 "uniform vec4 frustumPlanes[6];\n"
+																 "uniform bool occlusion;\n"
+																 "uniform mat4 previousViewProjection;\n"
+																 "uniform ivec2 screenSize;\n"
+																 "uniform int hiZLevels;\n"
+																 // Verdadeiro se a caixa da esfera, vista no frame anterior, está atrás da Hi-Z
+																 "bool occluded(vec3 center, float radius)\n"
+																 "{\n"
+																 "vec3 boxMin = vec3(1.0), boxMax = vec3(0.0);\n"
+																 "for (int i = 0; i < 8; i++)\n"
+																 "{\n"
+																 "    vec3 corner = center + radius * vec3((i & 1) != 0 ? 1.0 : -1.0, (i & 2) != 0 ? 1.0 : -1.0, (i & 4) != 0 ? 1.0 : -1.0);\n"
+																 "    vec4 clip = previousViewProjection * vec4(corner, 1.0);\n"
+																 "    if (clip.w <= 0.0)\n"
+																 "        return false;\n" // cruza o plano da câmera: não dá para afirmar nada
+																 "    vec3 window = clip.xyz / clip.w * 0.5 + 0.5;\n"
+																 "    boxMin = i == 0 ? window : min(boxMin, window);\n"
+																 "    boxMax = i == 0 ? window : max(boxMax, window);\n"
+																 "}\n"
+																 "if (boxMin.z > 1.0 || any(greaterThan(boxMin.xy, vec2(1.0))) || any(lessThan(boxMax.xy, vec2(0.0))))\n"
+																 "    return false;\n" // fora da Hi-Z: o teste do frustum decide
+																 "ivec2 pixelMin = clamp(ivec2(boxMin.xy * vec2(screenSize)), ivec2(0), screenSize - 1);\n"
+																 "ivec2 pixelMax = clamp(ivec2(boxMax.xy * vec2(screenSize)), ivec2(0), screenSize - 1);\n"
+																 // Nível em que o retângulo cobre no máximo 3x3 texels
+																 "int level = 0;\n"
+																 "ivec2 extent = pixelMax - pixelMin;\n"
+																 "while (level < hiZLevels - 1 && max(extent.x, extent.y) >> level > 1)\n"
+																 "    level++;\n"
+																 "ivec2 levelSize = textureSize(hiZ, level);\n"
+																 "ivec2 texelMin = min(pixelMin >> level, levelSize - 1);\n"
+																 "ivec2 texelMax = min(pixelMax >> level, levelSize - 1);\n"
+																 "float farthest = 0.0;\n"
+																 "for (int y = texelMin.y; y <= texelMax.y; y++)\n"
+																 "    for (int x = texelMin.x; x <= texelMax.x; x++)\n"
+																 "        farthest = max(farthest, texelFetch(hiZ, ivec2(x, y), level).r);\n"
+																 "return boxMin.z > farthest;\n"
+																 "}\n"
+																 "void main()\n"
+																 "{\n"
+																 "uint index = gl_GlobalInvocationID.x;\n"
+																 "if (index >= objectCount)\n"
+																 "    return;\n"
+																 "uint command = objectCommands[index];\n"
+																 "mat4 object = objects[index];\n"
+																 "vec4 sphere = spheres[command];\n"
+																 "vec3 center = vec3(object * vec4(sphere.xyz, 1.0));\n"
+																 "float scale = max(length(object[0].xyz), max(length(object[1].xyz), length(object[2].xyz)));\n"
+																 "float radius = sphere.w * scale;\n"
+																 "for (int i = 0; i < 6; i++)\n"
+																 "{\n"
+																 "    if (dot(frustumPlanes[i].xyz, center) + frustumPlanes[i].w < -radius)\n"
+																 "    {\n"
+																 "        atomicAdd(frustumCulled, 1u);\n"
+																 "        return;\n"
+																 "    }\n"
+																 "}\n"
+																 "if (occlusion && occluded(center, radius))\n"
+																 "{\n"
+																 "    atomicAdd(occlusionCulled, 1u);\n"
+																 "    return;\n"
+																 "}\n"
+																 "uint slot = atomicAdd(commands[command].instanceCount, 1u);\n"
+																 "visibleObjects[commands[command].baseInstance + slot] = index;\n"
+																 "atomicAdd(visibleCount, 1u);\n"
+																 "}\0";
+
+struct CullStats
+{
+	GLuint visible = 0, frustumCulled = 0, occlusionCulled = 0;
+	bool valid = false; // já houve algum frame lido
+};
+
+class GpuCulling
+{
+public:
+	~GpuCulling() { destroy(); }
+
+	// Os programas de culling vão para o ShaderManager: enquanto não ficam
+	// prontos, cull() não faz nada e o lote é desenhado inteiro
+	bool create(ShaderManager &shaders, const MeshArena &arena, const DrawBatch &batch, GLsizei width, GLsizei height)
+	{
+		destroy();
+		manager = &shaders;
+		cullHandle = shaders.submit("cull", {{GL_COMPUTE_SHADER, cullShaderSource}});
+		hiZHandle = shaders.submit("hiz", {{GL_COMPUTE_SHADER, hiZBuildShaderSource}});
+		objectBuffer = batch.objectBufferId();
+		commandBuffer = batch.commandBufferId();
+		objectCount = (GLuint)batch.objects();
+
+		// Comandos com instanceCount zerado, copiados sobre os do lote a cada frame
+		std::vector<DrawElementsIndirectCommand> commands = batch.commandList();
+		std::vector<GLuint> objectCommands(objectCount);
+		std::vector<glm::vec4> spheres;
+		for (size_t c = 0; c < commands.size(); c++)
+		{
+			for (GLuint i = 0; i < commands[c].instanceCount; i++)
+				objectCommands[commands[c].baseInstance + i] = (GLuint)c;
+			commands[c].instanceCount = 0;
+
+			const ArenaMesh &mesh = arena.mesh(batch.commandMesh(c));
+			spheres.push_back(boundingSphere(mesh.boundsMin, mesh.boundsMax));
+		}
+		commandBytes = commands.size() * sizeof(DrawElementsIndirectCommand);
+
+		glCreateBuffers(1, &resetCommandBuffer);
+		glNamedBufferStorage(resetCommandBuffer, std::max<size_t>(commandBytes, 1), commands.data(), 0);
+		glCreateBuffers(1, &objectCommandBuffer);
+		glNamedBufferStorage(objectCommandBuffer, std::max<size_t>(objectCommands.size(), 1) * sizeof(GLuint), objectCommands.data(), 0);
+		glCreateBuffers(1, &sphereBuffer);
+		glNamedBufferStorage(sphereBuffer, std::max<size_t>(spheres.size(), 1) * sizeof(glm::vec4), spheres.data(), 0);
+		glCreateBuffers(1, &visibleBuffer);
+		glNamedBufferStorage(visibleBuffer, std::max<GLuint>(objectCount, 1) * sizeof(GLuint), nullptr, 0);
+
+		// Uma região de contadores por frame em voo (offset alinhado para SSBO)
+		GLint alignment = 256;
+		glGetIntegerv(GL_SHADER_STORAGE_BUFFER_OFFSET_ALIGNMENT, &alignment);
+		counterStride = std::max<GLsizeiptr>(alignment, 4 * sizeof(GLuint));
+		glCreateBuffers(1, &counterBuffer);
+		glNamedBufferStorage(counterBuffer, counterStride * CULL_STATS_LATENCY, nullptr, GL_DYNAMIC_STORAGE_BIT);
+
+		// Pirâmide Hi-Z: profundidade máxima, do tamanho da tela até 1x1
+		screenWidth = width;
+		screenHeight = height;
+		hiZLevels = 1;
+		while ((std::max(width, height) >> hiZLevels) > 0)
+			hiZLevels++;
+		glCreateTextures(GL_TEXTURE_2D, 1, &hiZ);
+		glTextureStorage2D(hiZ, hiZLevels, GL_R32F, width, height);
+		glTextureParameteri(hiZ, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_NEAREST);
+		glTextureParameteri(hiZ, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+		return true;
+	}
+
+	void destroy()
+	{
+		for (GLsync &fence : fences)
+		{
+			if (fence)
+				glDeleteSync(fence);
+			fence = nullptr;
+		}
+		GLuint buffers[5] = {resetCommandBuffer, objectCommandBuffer, sphereBuffer, visibleBuffer, counterBuffer};
+		glDeleteBuffers(5, buffers);
+		resetCommandBuffer = objectCommandBuffer = sphereBuffer = visibleBuffer = counterBuffer = 0;
+		if (hiZ)
+			glDeleteTextures(1, &hiZ);
+		hiZ = 0;
+		// Os programas são do ShaderManager
+		cullProgram = hiZProgram = 0;
+		manager = nullptr;
+		hiZValid = false;
+		frame = 0;
+	}
+
+	// Reescreve os comandos do lote só com os objetos visíveis. Deixa o
+	// programa de culling em uso: o chamador volta ao seu programa depois.
+	// Devolve false (sem mexer nos comandos) se os programas ainda não estão prontos.
+	bool cull(const glm::mat4 &viewProjection)
+	{
+		if (!programsReady())
+			return false;
+		readCounters();
+
+		const unsigned region = frame % CULL_STATS_LATENCY;
+		glCopyNamedBufferSubData(resetCommandBuffer, commandBuffer, 0, 0, commandBytes);
+		glClearNamedBufferSubData(counterBuffer, GL_R32UI, region * counterStride, 4 * sizeof(GLuint), GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+
+		RenderState &state = renderState();
+		state.bindBufferBase(GL_SHADER_STORAGE_BUFFER, BATCH_OBJECT_BINDING, objectBuffer);
+		state.bindBufferBase(GL_SHADER_STORAGE_BUFFER, BATCH_VISIBLE_BINDING, visibleBuffer);
+		state.bindBufferBase(GL_SHADER_STORAGE_BUFFER, CULL_COMMAND_BINDING, commandBuffer);
+		state.bindBufferBase(GL_SHADER_STORAGE_BUFFER, CULL_OBJECT_COMMAND_BINDING, objectCommandBuffer);
+		state.bindBufferBase(GL_SHADER_STORAGE_BUFFER, CULL_SPHERE_BINDING, sphereBuffer);
+		state.bindBufferRange(GL_SHADER_STORAGE_BUFFER, CULL_COUNTER_BINDING, counterBuffer, region * counterStride, 4 * sizeof(GLuint));
+		state.bindTextureUnit(0, hiZ);
+
+		glm::vec4 planes[6];
+		extractFrustumPlanes(viewProjection, planes);
+
+		state.useProgram(cullProgram);
+		state.uniform(locations.objectCount, objectCount);
+		state.uniform(locations.viewProjection, viewProjection);
+		state.uniform(locations.frustumPlanes, planes, 6);
+		state.uniform(locations.occlusion, hiZValid && occlusionEnabled);
+		state.uniform(locations.previousViewProjection, previousViewProjection);
+		state.uniform(locations.screenSize, glm::ivec2(screenWidth, screenHeight));
+		state.uniform(locations.hiZLevels, (GLint)hiZLevels);
+		glDispatchCompute((objectCount + 63) / 64, 1, 1);
+
+		// Os comandos e a lista de visíveis são lidos pelo desenho logo em seguida
+		glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_SHADER_STORAGE_BARRIER_BIT);
+		fences[region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		frame++;
+		currentViewProjection = viewProjection;
+		return true;
+	}
+
+	// Depois do desenho: monta a Hi-Z a partir da profundidade do frame
+	void buildHiZ(const RenderTarget &target)
+	{
+		if (!programsReady())
+			return;
+		RenderState &state = renderState();
+		state.useProgram(hiZProgram);
+		state.bindTextureUnit(0, target.depthTexture());
+		GLsizei width = screenWidth, height = screenHeight;
+		for (int level = 0; level < hiZLevels; level++)
+		{
+			GLsizei levelWidth = std::max(1, screenWidth >> level), levelHeight = std::max(1, screenHeight >> level);
+			if (level > 0)
+				state.bindImageTexture(0, hiZ, level - 1, GL_FALSE, 0, GL_READ_ONLY, GL_R32F);
+			state.bindImageTexture(1, hiZ, level, GL_FALSE, 0, GL_WRITE_ONLY, GL_R32F);
+			state.uniform(locations.level, (GLint)level);
+			state.uniform(locations.sourceSize, glm::ivec2(width, height));
+			state.uniform(locations.destinationSize, glm::ivec2(levelWidth, levelHeight));
+			glDispatchCompute((levelWidth + 7) / 8, (levelHeight + 7) / 8, 1);
+			glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT | GL_TEXTURE_FETCH_BARRIER_BIT);
+			width = levelWidth;
+			height = levelHeight;
+		}
+		previousViewProjection = currentViewProjection;
+		hiZValid = true;
+	}
+
+	// Os programas de culling já compilaram (cull() vai rodar de verdade)
+	bool ready() { return programsReady(); }
+
+	// Liga a lista de objetos visíveis para o vertex shader
+	void bindVisibleObjects() const { renderState().bindBufferBase(GL_SHADER_STORAGE_BUFFER, BATCH_VISIBLE_BINDING, visibleBuffer); }
+
+	int levels() const { return hiZLevels; }
+	const CullStats &stats() const { return lastStats; }
+
+	bool occlusionEnabled = true;
+
+private:
+	// Pega os programas (e os uniforms) quando o ShaderManager termina os dois
+	bool programsReady()
+	{
+		if (cullProgram)
+			return true;
+		if (!manager || !manager->ready(cullHandle) || !manager->ready(hiZHandle))
+			return false;
+		cullProgram = manager->program(cullHandle);
+		hiZProgram = manager->program(hiZHandle);
+
+		locations.objectCount = glGetUniformLocation(cullProgram, "objectCount");
+		locations.viewProjection = glGetUniformLocation(cullProgram, "viewProjection");
+		locations.frustumPlanes = glGetUniformLocation(cullProgram, "frustumPlanes");
+		locations.occlusion = glGetUniformLocation(cullProgram, "occlusion");
+		locations.previousViewProjection = glGetUniformLocation(cullProgram, "previousViewProjection");
+		locations.screenSize = glGetUniformLocation(cullProgram, "screenSize");
+		locations.hiZLevels = glGetUniformLocation(cullProgram, "hiZLevels");
+		locations.level = glGetUniformLocation(hiZProgram, "level");
+		locations.sourceSize = glGetUniformLocation(hiZProgram, "sourceSize");
+		locations.destinationSize = glGetUniformLocation(hiZProgram, "destinationSize");
+		return true;
+	}
+
+	// Lê os contadores do frame mais antigo ainda não lido, se a GPU já terminou
+	void readCounters()
+	{
+		const unsigned region = frame % CULL_STATS_LATENCY;
+		GLsync &fence = fences[region];
+		if (!fence)
+			return;
+		if (glClientWaitSync(fence, 0, 0) != GL_TIMEOUT_EXPIRED)
+		{
+			GLuint counters[3];
+			glGetNamedBufferSubData(counterBuffer, region * counterStride, sizeof(counters), counters);
+			lastStats.visible = counters[0];
+			lastStats.frustumCulled = counters[1];
+			lastStats.occlusionCulled = counters[2];
+			lastStats.valid = true;
+		}
+		glDeleteSync(fence);
+		fence = nullptr;
+	}
+
+	struct
+	{
+		GLint objectCount, viewProjection, frustumPlanes, occlusion, previousViewProjection, screenSize, hiZLevels;
+		GLint level, sourceSize, destinationSize;
+	} locations = {};
+
+	ShaderManager *manager = nullptr;
+	size_t cullHandle = 0, hiZHandle = 0;
+	GLuint cullProgram = 0, hiZProgram = 0;
+	GLuint objectBuffer = 0, commandBuffer = 0; // do lote (não são deste objeto)
+	GLuint resetCommandBuffer = 0, objectCommandBuffer = 0, sphereBuffer = 0, visibleBuffer = 0, counterBuffer = 0;
+	GLuint hiZ = 0;
+	GLuint objectCount = 0;
+	size_t commandBytes = 0;
+	GLsizeiptr counterStride = 0;
+	GLsizei screenWidth = 0, screenHeight = 0;
+	int hiZLevels = 0;
+	bool hiZValid = false;
+	glm::mat4 currentViewProjection = glm::mat4(1.0f), previousViewProjection = glm::mat4(1.0f);
+	unsigned frame = 0;
+	GLsync fences[CULL_STATS_LATENCY] = {};
+	CullStats lastStats;
+};
@@ -0,0 +1,233 @@
+/* GpuProfiler.h - tempo de GPU por trecho do frame, sem parar a CPU
+ *
+ * O tempo medido na CPU em volta de um glDraw* é só o custo de enfileirar o
+ * comando; a GPU executa depois. Para saber onde vai o tempo da GPU, cada
+ * trecho (passo da fila, culling, Hi-Z, cópia para a janela) fica entre dois
+ * glQueryCounter(GL_TIMESTAMP): a diferença é o tempo do trecho na GPU.
+ * Carimbos de tempo, ao contrário de GL_TIME_ELAPSED, podem ser aninhados
+ * (e convivem com a consulta do FrameBenchmark em volta do frame).
+ *
+ * As consultas de cada frame ficam numa posição de um anel de
+ * GPU_PROFILER_FRAMES frames. Quando o frame volta à mesma posição, os
+ * resultados são lidos só se a última consulta dela já tem resultado
+ * (GL_QUERY_RESULT_AVAILABLE; as anteriores terminaram antes, na ordem dos
+ * comandos). Se a GPU estiver mais atrasada que isso, o frame é descartado em
+ * vez de esperar: nunca há glGetQueryObject bloqueante durante o loop (só
+ * finish(), depois do último frame, espera os que faltam).
+ *
+ * Os tempos são somados por trecho (nome e profundidade) até resetStats().
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+
+// Frames em voo no anel (o resultado é lido GPU_PROFILER_FRAMES frames depois)
+const unsigned GPU_PROFILER_FRAMES = 4;
+// Trechos por frame; os que passarem disso não são medidos
+const unsigned GPU_PROFILER_SCOPES = 32;
+
+// Tempo somado de um trecho
+struct GpuTiming
+{
+	const char *name = nullptr;
+	unsigned depth = 0; // 0 = trecho de fora, 1 = dentro dele, ...
+	double totalMs = 0.0, maxMs = 0.0;
+	uint32_t samples = 0;
+
+	double averageMs() const { return samples ? totalMs / samples : 0.0; }
+};
+
+class GpuProfiler
+{
+public:
+	~GpuProfiler() { destroy(); }
+
+	void create()
+	{
+		destroy();
+		glCreateQueries(GL_TIMESTAMP, GPU_PROFILER_FRAMES * GPU_PROFILER_SCOPES * 2, queries);
+	}
+
+	void destroy()
+	{
+		if (queries[0])
+			glDeleteQueries(GPU_PROFILER_FRAMES * GPU_PROFILER_SCOPES * 2, queries);
+		memset(queries, 0, sizeof(queries));
+		for (Frame &f : frames)
+			f = Frame();
+		frame = 0;
+		depth = 0;
+		skipped = 0;
+	}
+
+	bool active() const { return queries[0] != 0; }
+
+	// Começo do frame: lê (se já terminou) o frame que usou esta posição do anel
+	void beginFrame()
+	{
+		if (!active())
+			return;
+		Frame &f = frames[frame % GPU_PROFILER_FRAMES];
+		collect(frame % GPU_PROFILER_FRAMES, false);
+		f = Frame();
+		depth = 0;
+		skipped = 0;
+	}
+
+	// Abre um trecho; name precisa continuar vivo (literal)
+	void begin(const char *name)
+	{
+		if (!active())
+			return;
+		Frame &f = frames[frame % GPU_PROFILER_FRAMES];
+		if (f.count == GPU_PROFILER_SCOPES || skipped > 0)
+		{
+			skipped++;
+			return;
+		}
+		Scope &scope = f.scopes[f.count];
+		scope.name = name;
+		scope.depth = depth;
+		stack[depth++] = f.count;
+		glQueryCounter(query(frame % GPU_PROFILER_FRAMES, f.count, 0), GL_TIMESTAMP);
+		f.count++;
+	}
+
+	// Fecha o último trecho aberto
+	void end()
+	{
+		if (!active())
+			return;
+		if (skipped > 0)
+		{
+			skipped--;
+			return;
+		}
+		if (depth == 0)
+			return;
+		Frame &f = frames[frame % GPU_PROFILER_FRAMES];
+		const unsigned index = stack[--depth];
+		f.lastQuery = query(frame % GPU_PROFILER_FRAMES, index, 1);
+		glQueryCounter(f.lastQuery, GL_TIMESTAMP);
+	}
+
+	// Fim do frame: fecha o que ficou aberto
+	void endFrame()
+	{
+		if (!active())
+			return;
+		while (depth > 0 || skipped > 0)
+			end();
+		frames[frame % GPU_PROFILER_FRAMES].pending = frames[frame % GPU_PROFILER_FRAMES].count > 0;
+		frame++;
+	}
+
+	// Depois do último frame: lê os frames ainda em voo (esperando a GPU)
+	void finish()
+	{
+		if (!active())
+			return;
+		for (uint64_t i = 0; i < GPU_PROFILER_FRAMES; i++)
+			collect((frame + i) % GPU_PROFILER_FRAMES, true);
+	}
+
+	// Trechos na ordem em que apareceram pela primeira vez
+	const std::vector<GpuTiming> &timings() const { return results; }
+	// Frames lidos e descartados (GPU atrasada demais) desde o último resetStats()
+	uint32_t collectedFrames() const { return collected; }
+	uint32_t droppedFrames() const { return dropped; }
+
+	// Um trecho por linha, recuado pela profundidade
+	void print() const
+	{
+		std::cout << "  GPU por trecho (media de " << collected << " frames, " << dropped << " descartados sem esperar):" << std::endl;
+		for (const GpuTiming &timing : results)
+			std::cout << "    " << std::string(timing.depth * 2, ' ') << timing.name << ": " << timing.averageMs() << " ms (max "
+								<< timing.maxMs << " ms)" << std::endl;
+	}
+
+	void resetStats()
+	{
+		results.clear();
+		collected = 0;
+		dropped = 0;
+	}
+
+private:
+	struct Scope
+	{
+		const char *name = nullptr;
+		unsigned depth = 0;
+	};
+
+	struct Frame
+	{
+		Scope scopes[GPU_PROFILER_SCOPES];
+		unsigned count = 0;
+		GLuint lastQuery = 0;
+		bool pending = false; // tem consultas ainda não lidas
+	};
+
+	// Par de consultas (0 = começo, 1 = fim) do trecho index da posição slot do anel
+	GLuint query(uint64_t slot, unsigned index, unsigned which) const
+	{
+		return queries[(slot * GPU_PROFILER_SCOPES + index) * 2 + which];
+	}
+
+	// Soma os tempos da posição slot; sem wait, descarta se a GPU não terminou
+	void collect(uint64_t slot, bool wait)
+	{
+		Frame &f = frames[slot];
+		if (!f.pending)
+			return;
+		f.pending = false;
+		GLint available = GL_FALSE;
+		if (!wait)
+			glGetQueryObjectiv(f.lastQuery, GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!wait && !available)
+		{
+			dropped++;
+			return;
+		}
+		for (unsigned i = 0; i < f.count; i++)
+		{
+			GLuint64 begin = 0, end = 0;
+			glGetQueryObjectui64v(query(slot, i, 0), GL_QUERY_RESULT, &begin);
+			glGetQueryObjectui64v(query(slot, i, 1), GL_QUERY_RESULT, &end);
+			GpuTiming &timing = find(f.scopes[i]);
+			const double ms = end > begin ? (end - begin) / 1e6 : 0.0;
+			timing.totalMs += ms;
+			timing.maxMs = std::max(timing.maxMs, ms);
+			timing.samples++;
+		}
+		collected++;
+	}
+
+	// Poucos trechos por frame: busca linear (nomes comparados pelo texto)
+	GpuTiming &find(const Scope &scope)
+	{
+		for (GpuTiming &timing : results)
+			if (timing.depth == scope.depth && strcmp(timing.name, scope.name) == 0)
+				return timing;
+		results.emplace_back();
+		results.back().name = scope.name;
+		results.back().depth = scope.depth;
+		return results.back();
+	}
+
+	GLuint queries[GPU_PROFILER_FRAMES * GPU_PROFILER_SCOPES * 2] = {};
+	Frame frames[GPU_PROFILER_FRAMES];
+	unsigned stack[GPU_PROFILER_SCOPES] = {}; // trechos abertos
+	unsigned depth = 0, skipped = 0;
+	uint64_t frame = 0;
+	std::vector<GpuTiming> results;
+	uint32_t collected = 0, dropped = 0;
+};
@@ -0,0 +1,29 @@
+/* Hash.h - hash de 64 bits para identificar conteúdo (caches em disco)
+ *
+ * Não é criptográfico: serve para detectar que um arquivo ou um texto mudou.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+// Hash de 64 bits do conteúdo, lendo 8 bytes por vez
+inline uint64_t hashBytes(const uint8_t *data, size_t size)
+{
+	const uint64_t prime = 0x9E3779B97F4A7C15ull;
+	uint64_t h = size * prime;
+	size_t i = 0;
+	for (; i + 8 <= size; i += 8)
+	{
+		uint64_t word;
+		memcpy(&word, data + i, 8);
+		h = (h ^ (word * prime)) * 0xBF58476D1CE4E5B9ull;
+		h ^= h >> 31;
+	}
+	uint64_t tail = 0;
+	memcpy(&tail, data + i, size - i);
+	h = (h ^ (tail * prime)) * 0x94D049BB133111EBull;
+	return h ^ (h >> 29);
+}
@@ -0,0 +1,155 @@
+/* Headless.h - contexto OpenGL sem janela nem display (EGL surfaceless)
+ *
+ * Para rodar em máquinas sem monitor nem servidor gráfico (build, render farm,
+ * medições automáticas). O contexto é criado direto na EGL, sem superfície
+ * (EGL_KHR_surfaceless_context); de preferência na plataforma surfaceless da
+ * Mesa, que não precisa de X11/Wayland nem de GPU (cai no llvmpipe). Como
+ * não existe framebuffer padrão, quem desenha usa um RenderTarget.
+ *
+ * present() faz o papel do glfwSwapBuffers: uma cerca por frame, e a CPU
+ * espera a do frame de HEADLESS_FRAMES_IN_FLIGHT frames atrás. Sem isso a CPU
+ * enfileiraria frames sem limite e o tempo por frame não significaria nada.
+ *
+ * Só existe se compilado com HEADLESS_EGL (o CMakelists.txt define quando
+ * encontra a EGL); sem ela create() avisa e falha.
+ */
+
+#pragma once
+
+#include <cstring>
+#include <iostream>
+
+#include <glad/glad.h>
+
+#ifdef HEADLESS_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
+const unsigned HEADLESS_FRAMES_IN_FLIGHT = 2;
+
+class HeadlessContext
+{
+public:
+	~HeadlessContext() { destroy(); }
+
+	// Cria o contexto (core 4.6, ou 4.5) e o deixa atual neste thread
+	bool create()
+	{
+#ifdef HEADLESS_EGL
+		destroy();
+		const char *clientExtensions = eglQueryString(EGL_NO_DISPLAY, EGL_EXTENSIONS);
+		PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay =
+				(PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+		if (getPlatformDisplay && clientExtensions && strstr(clientExtensions, "EGL_MESA_platform_surfaceless"))
+			display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+		if (display == EGL_NO_DISPLAY)
+			display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+		EGLint major, minor;
+		if (display == EGL_NO_DISPLAY || !eglInitialize(display, &major, &minor))
+		{
+			std::cout << "ERROR::HEADLESS::EGL_DISPLAY_FAILED" << std::endl;
+			display = EGL_NO_DISPLAY;
+			return false;
+		}
+		const char *extensions = eglQueryString(display, EGL_EXTENSIONS);
+		if (!extensions || !strstr(extensions, "EGL_KHR_surfaceless_context") || !eglBindAPI(EGL_OPENGL_API))
+		{
+			std::cout << "ERROR::HEADLESS::SURFACELESS_OPENGL_NOT_SUPPORTED" << std::endl;
+			destroy();
+			return false;
+		}
+
+		// Qualquer tipo de superfície: nenhuma vai ser criada
+		const EGLint configAttributes[] = {EGL_SURFACE_TYPE, 0, EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE};
+		EGLConfig config;
+		EGLint configs = 0;
+		if (!eglChooseConfig(display, configAttributes, &config, 1, &configs) || configs == 0)
+		{
+			std::cout << "ERROR::HEADLESS::NO_CONFIG" << std::endl;
+			destroy();
+			return false;
+		}
+		for (EGLint version : {6, 5})
+		{
+			const EGLint contextAttributes[] = {EGL_CONTEXT_MAJOR_VERSION, 4, EGL_CONTEXT_MINOR_VERSION, version,
+																					EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT, EGL_NONE};
+			context = eglCreateContext(display, config, EGL_NO_CONTEXT, contextAttributes);
+			if (context != EGL_NO_CONTEXT)
+				break;
+		}
+		if (context == EGL_NO_CONTEXT || !eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, context))
+		{
+			std::cout << "ERROR::HEADLESS::CONTEXT_FAILED (OpenGL 4.5 core)" << std::endl;
+			destroy();
+			return false;
+		}
+		std::cout << "Sem janela: EGL " << major << "." << minor << ", contexto surfaceless" << std::endl;
+		return true;
+#else
+		std::cout << "ERROR::HEADLESS::EGL_NOT_AVAILABLE (compilado sem EGL)" << std::endl;
+		return false;
+#endif
+	}
+
+	// Carregador de funções para a GLAD
+	static void *procAddress(const char *name)
+	{
+#ifdef HEADLESS_EGL
+		return (void *)eglGetProcAddress(name);
+#else
+		(void)name;
+		return nullptr;
+#endif
+	}
+
+	// Fim do frame: cerca deste frame, espera a de HEADLESS_FRAMES_IN_FLIGHT frames atrás
+	void present()
+	{
+		GLsync &fence = fences[frame++ % HEADLESS_FRAMES_IN_FLIGHT];
+		if (fence)
+		{
+			glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, ~0ull);
+			glDeleteSync(fence);
+		}
+		fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	}
+
+	void destroy()
+	{
+#ifdef HEADLESS_EGL
+		if (context != EGL_NO_CONTEXT)
+		{
+			for (GLsync &fence : fences)
+				if (fence)
+					glDeleteSync(fence);
+			eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+			eglDestroyContext(display, context);
+		}
+		if (display != EGL_NO_DISPLAY)
+			eglTerminate(display);
+		context = EGL_NO_CONTEXT;
+		display = EGL_NO_DISPLAY;
+#endif
+		for (GLsync &fence : fences)
+			fence = nullptr;
+		frame = 0;
+	}
+
+	bool active() const
+	{
+#ifdef HEADLESS_EGL
+		return context != EGL_NO_CONTEXT;
+#else
+		return false;
+#endif
+	}
+
+private:
+#ifdef HEADLESS_EGL
+	EGLDisplay display = EGL_NO_DISPLAY;
+	EGLContext context = EGL_NO_CONTEXT;
+#endif
+	GLsync fences[HEADLESS_FRAMES_IN_FLIGHT] = {};
+	unsigned frame = 0;
+};
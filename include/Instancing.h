@@ -0,0 +1,121 @@
+/* Instancing.h - desenho de muitas cópias da mesma malha
+ *
+ * As matrizes de modelo de cada cópia (instância) ficam num VBO próprio e entram
+ * no vertex shader como um atributo mat4 (locations 2 a 5) lido de um binding
+ * próprio do VAO com divisor 1, ou seja, o atributo avança uma vez por instância
+ * e não por vértice. Assim N objetos são desenhados com um único
+ * glDrawElementsInstanced.
+ *
+ * Quando a malha é desenhada sem instâncias, o atributo fica desligado e vale a
+ * identidade (setIdentityInstanceAttribute).
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+// Primeira location do atributo mat4 (ocupa 4 locations seguidas)
+const GLuint INSTANCE_MATRIX_LOCATION = 2;
+// Binding do VAO para o buffer de instâncias (o 0 é o dos vértices)
+const GLuint INSTANCE_BUFFER_BINDING = 1;
+
+// Valor pseudo-aleatório em [0, 1) para o índice i (sempre o mesmo entre execuções)
+inline float instanceRandom(uint32_t i, uint32_t seed)
+{
+	uint32_t h = i * 0x9E3779B1u ^ seed * 0x85EBCA6Bu;
+	h ^= h >> 16;
+	h *= 0x7FEB352Du;
+	h ^= h >> 15;
+	h *= 0x846CA68Bu;
+	h ^= h >> 16;
+	return (h >> 8) * (1.0f / 16777216.0f);
+}
+
+// Distribui count objetos numa grade 3D dentro do cubo [-0.9, 0.9], cada um com
+// uma rotação própria. meshTransform (ajuste/quantização da malha) é aplicada
+// antes da transformação de cada instância.
+inline std::vector<glm::mat4> makeInstanceGrid(size_t count, const glm::mat4 &meshTransform)
+{
+	std::vector<glm::mat4> transforms;
+	transforms.reserve(count);
+
+	size_t side = (size_t)std::ceil(std::cbrt((double)count));
+	if (side == 0)
+		side = 1;
+	const float cell = 1.8f / side;
+	const float scale = cell * 0.7f;
+
+	for (size_t i = 0; i < count; i++)
+	{
+		size_t x = i % side, y = (i / side) % side, z = i / (side * side);
+		glm::vec3 center = glm::vec3(-0.9f) + glm::vec3(x + 0.5f, y + 0.5f, z + 0.5f) * cell;
+
+		glm::vec3 axis(instanceRandom((uint32_t)i, 1) - 0.5f, instanceRandom((uint32_t)i, 2) - 0.5f, instanceRandom((uint32_t)i, 3) - 0.5f);
+		if (glm::length(axis) < 1e-3f)
+			axis = glm::vec3(0.0f, 1.0f, 0.0f);
+		float angle = instanceRandom((uint32_t)i, 4) * 6.2831853f;
+
+		glm::mat4 m = glm::translate(glm::mat4(1.0f), center);
+		m = glm::rotate(m, angle, axis);
+		m = glm::scale(m, glm::vec3(scale));
+		transforms.push_back(m * meshTransform);
+	}
+	return transforms;
+}
+
+// Matriz da instância i girando em torno do próprio centro, com eixo e
+// velocidade próprios (animação calculada na CPU a cada frame)
+inline glm::mat4 spinInstance(const glm::mat4 &base, uint32_t i, float time)
+{
+	glm::vec3 center = glm::vec3(base[3]);
+	glm::vec3 axis(instanceRandom(i, 5) - 0.5f, instanceRandom(i, 6) - 0.5f, instanceRandom(i, 7) - 0.5f);
+	if (glm::length(axis) < 1e-3f)
+		axis = glm::vec3(0.0f, 1.0f, 0.0f);
+	float speed = 0.5f + 2.0f * instanceRandom(i, 8);
+
+	glm::mat4 m = glm::translate(glm::mat4(1.0f), center);
+	m = glm::rotate(m, time * speed, axis);
+	m = glm::translate(m, -center);
+	return m * base;
+}
+
+// Cria o VBO com as matrizes das instâncias (fixas depois de criadas)
+inline GLuint createInstanceBuffer(const std::vector<glm::mat4> &transforms)
+{
+	GLuint buffer;
+	glCreateBuffers(1, &buffer);
+	glNamedBufferStorage(buffer, std::max<size_t>(transforms.size(), 1) * sizeof(glm::mat4), transforms.data(), 0);
+	return buffer;
+}
+
+// Liga o buffer de instâncias ao VAO: um mat4 ocupa 4 atributos vec4, um por coluna
+inline void attachInstanceBuffer(GLuint VAO, GLuint instanceBuffer)
+{
+	glVertexArrayVertexBuffer(VAO, INSTANCE_BUFFER_BINDING, instanceBuffer, 0, sizeof(glm::mat4));
+	glVertexArrayBindingDivisor(VAO, INSTANCE_BUFFER_BINDING, 1);
+	for (GLuint column = 0; column < 4; column++)
+	{
+		GLuint location = INSTANCE_MATRIX_LOCATION + column;
+		glVertexArrayAttribFormat(VAO, location, 4, GL_FLOAT, GL_FALSE, column * sizeof(glm::vec4));
+		glVertexArrayAttribBinding(VAO, location, INSTANCE_BUFFER_BINDING);
+		glEnableVertexArrayAttrib(VAO, location);
+	}
+}
+
+// Valor do atributo de instância quando ele não vem de um buffer: identidade
+inline void setIdentityInstanceAttribute()
+{
+	for (GLuint column = 0; column < 4; column++)
+	{
+		GLfloat value[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+		value[column] = 1.0f;
+		glVertexAttrib4fv(INSTANCE_MATRIX_LOCATION + column, value);
+	}
+}
@@ -0,0 +1,419 @@
+/* JobSystem.h - agendador de tarefas com roubo de trabalho
+ *
+ * Um thread por núcleo, criados uma vez só: o thread que cria o JobSystem (o
+ * principal) é o trabalhador 0 e os outros ficam esperando tarefas. Cada
+ * trabalhador tem a sua fila Chase-Lev: o dono empilha e desempilha no fundo
+ * sem trava, os outros roubam do topo com um compare-and-swap. Um trabalhador
+ * sem tarefas rouba de um colega; sem nada para roubar, dorme numa variável de
+ * condição até alguém enviar mais.
+ *
+ * Tarefas são pequenas: a função (lambda com capturas de até JOB_DATA_SIZE
+ * bytes, normalmente por referência) fica dentro da própria Job, que vem de
+ * um anel por trabalhador, então enviar uma tarefa não aloca memória.
+ *
+ * Cada tarefa pertence a um JobCounter, que conta as tarefas que faltam.
+ * wait(contador) não bloqueia: quem espera executa tarefas (as suas ou
+ * roubadas) até o contador zerar, então o thread principal também trabalha.
+ * Dependências: run(contador, fn, &antes) só coloca a tarefa na fila quando
+ * o contador antes zerar (a tarefa fica guardada nele até lá).
+ *
+ * Limitação: só o thread dono e os trabalhadores enviam tarefas; em qualquer
+ * outro thread (o da recarga de shaders, por exemplo) run() executa a tarefa
+ * na hora.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <CpuProfiler.h>
+
+inline unsigned workerThreadCount()
+{
+	unsigned n = std::thread::hardware_concurrency();
+	return n ? n : 1;
+}
+
+// Bytes para as capturas da função de uma tarefa
+const size_t JOB_DATA_SIZE = 48;
+// Tarefas na fila de um trabalhador (e no anel de onde elas vêm); potência de 2
+const size_t JOB_QUEUE_SIZE = 4096;
+
+class JobCounter;
+
+struct Job
+{
+	void (*invoke)(const Job &job) = nullptr;
+	alignas(16) unsigned char data[JOB_DATA_SIZE];
+	JobCounter *counter = nullptr;
+	std::atomic<bool> busy{false}; // na fila ou executando: não pode ser reaproveitada
+};
+
+class JobCounter
+{
+public:
+	JobCounter() = default;
+	JobCounter(const JobCounter &) = delete;
+	JobCounter &operator=(const JobCounter &) = delete;
+
+	bool done() const { return pending.load(std::memory_order_acquire) == 0; }
+
+private:
+	friend class JobSystem;
+	std::atomic<int64_t> pending{0};
+	std::mutex mutex;						// protege waiting
+	std::vector<Job *> waiting; // tarefas que dependem deste contador
+};
+
+// Fila Chase-Lev de tamanho fixo (Lê et al., "Correct and efficient
+// work-stealing for weak memory models", 2013)
+class JobDeque
+{
+public:
+	// Só o dono. false se estiver cheia.
+	bool push(Job *job)
+	{
+		const int64_t b = bottom.load(std::memory_order_relaxed);
+		const int64_t t = top.load(std::memory_order_acquire);
+		if (b - t >= (int64_t)JOB_QUEUE_SIZE)
+			return false;
+		jobs[b & (JOB_QUEUE_SIZE - 1)].store(job, std::memory_order_relaxed);
+		bottom.store(b + 1, std::memory_order_release); // publica a tarefa para quem rouba
+		return true;
+	}
+
+	// Só o dono: a mais nova
+	Job *pop()
+	{
+		const int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+		bottom.store(b, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		int64_t t = top.load(std::memory_order_relaxed);
+		if (t > b)
+		{
+			bottom.store(b + 1, std::memory_order_relaxed);
+			return nullptr;
+		}
+		Job *job = jobs[b & (JOB_QUEUE_SIZE - 1)].load(std::memory_order_relaxed);
+		if (t == b)
+		{
+			// Última tarefa: disputa com quem estiver roubando
+			if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				job = nullptr;
+			bottom.store(b + 1, std::memory_order_relaxed);
+		}
+		return job;
+	}
+
+	// Qualquer thread: a mais antiga
+	Job *steal()
+	{
+		int64_t t = top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		const int64_t b = bottom.load(std::memory_order_acquire);
+		if (t >= b)
+			return nullptr;
+		Job *job = jobs[t & (JOB_QUEUE_SIZE - 1)].load(std::memory_order_relaxed);
+		if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+			return nullptr;
+		return job;
+	}
+
+private:
+	alignas(64) std::atomic<int64_t> top{0};
+	alignas(64) std::atomic<int64_t> bottom{0};
+	std::atomic<Job *> jobs[JOB_QUEUE_SIZE] = {};
+};
+
+struct JobStats
+{
+	uint64_t executed = 0;
+	uint64_t stolen = 0;
+	uint64_t immediate = 0; // executadas na hora (fila ou anel cheio, thread de fora)
+};
+
+class JobSystem
+{
+public:
+	// threads = total de trabalhadores, contando o thread que cria
+	explicit JobSystem(unsigned threads = workerThreadCount())
+			: workers(std::max(threads, 1u))
+	{
+		owner = std::this_thread::get_id();
+		for (unsigned i = 1; i < workers.size(); i++)
+			workers[i].thread = std::thread([this, i]()
+																			{ workerLoop(i); });
+	}
+
+	~JobSystem()
+	{
+		{
+			std::lock_guard<std::mutex> lock(sleepMutex);
+			running = false;
+		}
+		wake.notify_all();
+		for (Worker &worker : workers)
+			if (worker.thread.joinable())
+				worker.thread.join();
+	}
+
+	JobSystem(const JobSystem &) = delete;
+	JobSystem &operator=(const JobSystem &) = delete;
+
+	unsigned threads() const { return (unsigned)workers.size(); }
+
+	// Envia fn() como tarefa do contador; com after, só depois que ele zerar
+	template <typename Function>
+	void run(JobCounter &counter, const Function &fn, JobCounter *after = nullptr)
+	{
+		static_assert(sizeof(Function) <= JOB_DATA_SIZE, "capturas grandes demais para uma tarefa (capture por referencia)");
+		static_assert(std::is_trivially_destructible<Function>::value, "a funcao de uma tarefa nao pode ter destrutor");
+
+		const int index = workerIndex();
+		Job *job = index >= 0 ? allocate(workers[index]) : nullptr;
+		if (!job)
+		{
+			// Sem fila (thread de fora) ou anel cheio: executa aqui
+			if (after)
+				wait(*after);
+			fn();
+			if (index >= 0)
+				workers[index].stats.immediate++;
+			return;
+		}
+		new (job->data) Function(fn);
+		job->invoke = [](const Job &j)
+		{ (*(const Function *)j.data)(); };
+		job->counter = &counter;
+		counter.pending.fetch_add(1, std::memory_order_relaxed);
+
+		if (after)
+		{
+			std::lock_guard<std::mutex> lock(after->mutex);
+			if (!after->done())
+			{
+				after->waiting.push_back(job);
+				return;
+			}
+		}
+		enqueue(workers[index], job);
+	}
+
+	// Executa tarefas até o contador zerar
+	void wait(JobCounter &counter)
+	{
+		const int index = workerIndex();
+		while (!counter.done())
+		{
+			Job *job = index >= 0 ? find((unsigned)index) : nullptr;
+			if (job)
+				execute((unsigned)index, job);
+			else
+				std::this_thread::yield();
+		}
+		// Garante que a última tarefa já soltou a trava do contador
+		std::lock_guard<std::mutex> lock(counter.mutex);
+	}
+
+	// fn(primeiro, último) em tarefas de até perJob itens de [0, count); espera todas
+	template <typename Function>
+	void parallelFor(size_t count, size_t perJob, const Function &fn)
+	{
+		perJob = std::max<size_t>(perJob, 1);
+		JobCounter counter;
+		for (size_t first = perJob; first < count; first += perJob)
+		{
+			const size_t last = std::min(count, first + perJob);
+			run(counter, [&fn, first, last]()
+					{ fn(first, last); });
+		}
+		if (count > 0)
+			fn((size_t)0, std::min(count, perJob));
+		wait(counter);
+	}
+
+	// Soma dos contadores de todos os trabalhadores (desde o último resetStats)
+	JobStats stats() const
+	{
+		JobStats total;
+		for (const Worker &worker : workers)
+		{
+			total.executed += worker.stats.executed;
+			total.stolen += worker.stats.stolen;
+			total.immediate += worker.stats.immediate;
+		}
+		return total;
+	}
+
+	void resetStats()
+	{
+		for (Worker &worker : workers)
+			worker.stats = JobStats();
+	}
+
+private:
+	struct Worker
+	{
+		JobDeque queue;
+		Job ring[JOB_QUEUE_SIZE]; // de onde vêm as tarefas que este trabalhador envia
+		size_t next = 0;
+		uint32_t random = 0; // escolha da vítima de roubo
+		JobStats stats;			 // só o dono escreve
+		std::thread thread;
+	};
+
+	// Índice do thread atual neste JobSystem, -1 se ele não for um trabalhador
+	int workerIndex() const
+	{
+		if (current.system == this)
+			return current.index;
+		if (std::this_thread::get_id() == owner)
+		{
+			current = {this, 0};
+			return 0;
+		}
+		return -1;
+	}
+
+	// Próxima posição livre do anel; nullptr se a tarefa de 4096 envios atrás
+	// ainda não terminou
+	static Job *allocate(Worker &worker)
+	{
+		Job *job = &worker.ring[worker.next & (JOB_QUEUE_SIZE - 1)];
+		if (job->busy.load(std::memory_order_acquire))
+			return nullptr;
+		worker.next++;
+		job->busy.store(true, std::memory_order_relaxed);
+		return job;
+	}
+
+	void enqueue(Worker &worker, Job *job)
+	{
+		if (!worker.queue.push(job))
+		{
+			execute((unsigned)(&worker - workers.data()), job);
+			worker.stats.immediate++;
+			return;
+		}
+		queued.fetch_add(1, std::memory_order_seq_cst);
+		if (sleeping.load(std::memory_order_seq_cst) > 0)
+		{
+			std::lock_guard<std::mutex> lock(sleepMutex);
+			wake.notify_one();
+		}
+	}
+
+	// Uma tarefa da própria fila ou roubada de outro trabalhador
+	Job *find(unsigned index)
+	{
+		Worker &self = workers[index];
+		if (Job *job = self.queue.pop())
+			return taken(job);
+		const unsigned n = (unsigned)workers.size();
+		self.random = self.random * 1664525u + 1013904223u;
+		const unsigned start = (self.random >> 16) % n;
+		for (unsigned k = 0; k < n; k++)
+		{
+			const unsigned victim = (start + k) % n;
+			if (victim == index)
+				continue;
+			if (Job *job = workers[victim].queue.steal())
+			{
+				self.stats.stolen++;
+				return taken(job);
+			}
+		}
+		return nullptr;
+	}
+
+	Job *taken(Job *job)
+	{
+		queued.fetch_sub(1, std::memory_order_relaxed);
+		return job;
+	}
+
+	void execute(unsigned index, Job *job)
+	{
+		{
+			ProfileZone zone("tarefa");
+			job->invoke(*job);
+		}
+		JobCounter *counter = job->counter;
+		job->busy.store(false, std::memory_order_release);
+		workers[index].stats.executed++;
+		finish(index, *counter);
+	}
+
+	// Desconta uma tarefa. A última zera o contador com a trava dele, junto com
+	// a retirada das tarefas que dependiam dele, que vão para a fila; depois
+	// disso o contador não é mais tocado (quem espera pode destruí-lo).
+	void finish(unsigned index, JobCounter &counter)
+	{
+		int64_t pending = counter.pending.load(std::memory_order_acquire);
+		while (pending > 1)
+			if (counter.pending.compare_exchange_weak(pending, pending - 1, std::memory_order_acq_rel))
+				return;
+		std::vector<Job *> ready;
+		{
+			std::lock_guard<std::mutex> lock(counter.mutex);
+			// Outra tarefa pode ter entrado no contador nesse meio tempo
+			if (counter.pending.fetch_sub(1, std::memory_order_acq_rel) != 1)
+				return;
+			ready.swap(counter.waiting);
+		}
+		for (Job *job : ready)
+			enqueue(workers[index], job);
+	}
+
+	void workerLoop(unsigned index)
+	{
+		current = {this, (int)index};
+		cpuProfiler().setThreadName("trabalhador " + std::to_string(index));
+		workers[index].random = index * 2654435761u;
+		while (running.load(std::memory_order_relaxed))
+		{
+			if (Job *job = find(index))
+			{
+				execute(index, job);
+				continue;
+			}
+			// Nada para fazer: dorme até alguém enfileirar uma tarefa
+			std::unique_lock<std::mutex> lock(sleepMutex);
+			sleeping.fetch_add(1, std::memory_order_seq_cst);
+			wake.wait(lock, [this]()
+								{ return queued.load(std::memory_order_seq_cst) > 0 || !running; });
+			sleeping.fetch_sub(1, std::memory_order_seq_cst);
+		}
+	}
+
+	struct Current
+	{
+		const JobSystem *system;
+		int index;
+	};
+	static inline thread_local Current current = {nullptr, -1};
+
+	std::vector<Worker> workers;
+	std::thread::id owner;
+	std::atomic<int64_t> queued{0}; // tarefas nas filas
+	std::atomic<int> sleeping{0};
+	std::atomic<bool> running{true};
+	std::mutex sleepMutex;
+	std::condition_variable wake;
+};
+
+// Agendador do programa (criado no primeiro uso, pelo thread principal)
+inline JobSystem &jobSystem()
+{
+	static JobSystem jobs;
+	return jobs;
+}
@@ -0,0 +1,259 @@
+/* Mesh.h - construção de malhas indexadas
+ *
+ * Recebe vértices "expandidos" (um vértice por canto de triângulo, como no array
+ * hardcoded de setupGeometry) e gera um buffer de vértices únicos + um buffer de
+ * índices (EBO). Vértices com a mesma posição e cor são enviados e transformados
+ * uma única vez; o cache pós-transformação da GPU reaproveita o resultado sempre
+ * que o mesmo índice reaparece.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <VertexFormat.h>
+
+// Malha indexada na memória da CPU
+struct IndexedMesh
+{
+	std::vector<Vertex> vertices;
+	std::vector<GLuint> indices;
+};
+
+// Malha já enviada para a GPU (o que o loop de desenho precisa saber)
+struct GPUMesh
+{
+	GLuint VAO = 0, VBO = 0, EBO = 0;
+	GLsizei vertexCount = 0;
+	GLsizei indexCount = 0;
+	GLenum indexType = GL_UNSIGNED_INT;
+	VertexFormat format;
+	glm::vec3 boundsMin = glm::vec3(0.0f), boundsMax = glm::vec3(0.0f); // caixa envolvente (espaço do modelo)
+};
+
+// Chave de hash de um vértice: os bits dos 6 floats. O -0.0 é convertido para
+// 0.0 antes, para que os dois sejam considerados o mesmo vértice.
+struct VertexKey
+{
+	uint32_t bits[6];
+
+	bool operator==(const VertexKey &other) const
+	{
+		return memcmp(bits, other.bits, sizeof(bits)) == 0;
+	}
+};
+
+struct VertexKeyHash
+{
+	size_t operator()(const VertexKey &key) const
+	{
+		// FNV-1a sobre as 6 palavras de 32 bits
+		uint64_t h = 1469598103934665603ull;
+		for (uint32_t word : key.bits)
+		{
+			h ^= word;
+			h *= 1099511628211ull;
+		}
+		return (size_t)(h ^ (h >> 32));
+	}
+};
+
+inline VertexKey makeVertexKey(const Vertex &v)
+{
+	const float values[6] = {v.position.x, v.position.y, v.position.z, v.color.r, v.color.g, v.color.b};
+	VertexKey key;
+	for (int i = 0; i < 6; i++)
+	{
+		float f = values[i] == 0.0f ? 0.0f : values[i];
+		memcpy(&key.bits[i], &f, sizeof(float));
+	}
+	return key;
+}
+
+// Tipo de índice do EBO: 16 bits sempre que todos os vértices couberem
+inline GLenum chooseIndexType(size_t vertexCount)
+{
+	return vertexCount <= 65536 ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+}
+
+inline size_t indexTypeSize(GLenum indexType)
+{
+	return indexType == GL_UNSIGNED_SHORT ? sizeof(GLushort) : sizeof(GLuint);
+}
+
+// Monta a malha indexada a partir de vértices intercalados x y z r g b
+// (stride em floats), eliminando os vértices repetidos
+inline IndexedMesh buildIndexedMesh(const GLfloat *interleaved, size_t vertexCount, size_t stride = 6)
+{
+	IndexedMesh mesh;
+	mesh.indices.reserve(vertexCount);
+
+	std::unordered_map<VertexKey, GLuint, VertexKeyHash> unique;
+	unique.reserve(vertexCount);
+
+	for (size_t i = 0; i < vertexCount; i++)
+	{
+		const GLfloat *src = interleaved + i * stride;
+		Vertex v;
+		v.position = glm::vec3(src[0], src[1], src[2]);
+		v.color = glm::vec3(src[3], src[4], src[5]);
+
+		auto inserted = unique.emplace(makeVertexKey(v), (GLuint)mesh.vertices.size());
+		if (inserted.second)
+			mesh.vertices.push_back(v);
+		mesh.indices.push_back(inserted.first->second);
+	}
+
+	return mesh;
+}
+
+// Formas simples, montadas a partir de triângulos expandidos como a pirâmide.
+// Cubo [-0.5, 0.5] com uma cor por face.
+inline IndexedMesh makeCubeMesh()
+{
+	static const int faces[6][4] = {{0, 1, 3, 2}, {4, 6, 7, 5}, {0, 4, 5, 1}, {2, 3, 7, 6}, {0, 2, 6, 4}, {1, 5, 7, 3}};
+	static const GLfloat colors[6][3] = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {0, 1, 1}, {1, 0, 1}, {1, 1, 0}};
+	static const int corners[6] = {0, 1, 2, 0, 2, 3};
+
+	std::vector<GLfloat> data;
+	for (int f = 0; f < 6; f++)
+	{
+		for (int c : corners)
+		{
+			int v = faces[f][c];
+			data.insert(data.end(), {(v & 1) - 0.5f, ((v >> 1) & 1) - 0.5f, ((v >> 2) & 1) - 0.5f, colors[f][0], colors[f][1], colors[f][2]});
+		}
+	}
+	return buildIndexedMesh(data.data(), data.size() / 6);
+}
+
+// Octaedro com os vértices nos eixos, cor de cada vértice pela direção
+inline IndexedMesh makeOctahedronMesh()
+{
+	static const GLfloat axes[6][3] = {{0.5f, 0, 0}, {-0.5f, 0, 0}, {0, 0.5f, 0}, {0, -0.5f, 0}, {0, 0, 0.5f}, {0, 0, -0.5f}};
+	static const GLfloat colors[6][3] = {{1, 0.5f, 0}, {0, 0.5f, 1}, {0.5f, 1, 0}, {1, 0, 0.5f}, {0.5f, 0, 1}, {0, 1, 0.5f}};
+
+	std::vector<GLfloat> data;
+	for (int x : {0, 1})
+		for (int y : {2, 3})
+			for (int z : {4, 5})
+			{
+				// Mantém a orientação dos triângulos consistente em todos os octantes
+				bool flip = (x + y + z) % 2 == 1;
+				int tri[3] = {x, flip ? z : y, flip ? y : z};
+				for (int v : tri)
+					data.insert(data.end(), {axes[v][0], axes[v][1], axes[v][2], colors[v][0], colors[v][1], colors[v][2]});
+			}
+	return buildIndexedMesh(data.data(), data.size() / 6);
+}
+
+// Malha já codificada no formato da GPU: bytes prontos para o glNamedBufferStorage
+struct PackedMesh
+{
+	GPUMesh info; // contagens, tipo de índice, formato e caixa envolvente (sem objetos GL)
+	std::vector<uint8_t> vertexData;
+	std::vector<uint8_t> indexData;
+};
+
+// Codifica os vértices no formato pedido e converte os índices para 16 bits
+// quando possível (metade da memória e da banda de leitura de índices)
+inline PackedMesh packMesh(const IndexedMesh &mesh, const VertexFormat &format)
+{
+	PackedMesh packed;
+	GPUMesh &info = packed.info;
+	info.vertexCount = (GLsizei)mesh.vertices.size();
+	info.indexCount = (GLsizei)mesh.indices.size();
+	info.indexType = chooseIndexType(mesh.vertices.size());
+	info.format = format;
+	if (!mesh.vertices.empty())
+	{
+		info.boundsMin = info.boundsMax = mesh.vertices[0].position;
+		for (const Vertex &v : mesh.vertices)
+		{
+			info.boundsMin = glm::min(info.boundsMin, v.position);
+			info.boundsMax = glm::max(info.boundsMax, v.position);
+		}
+	}
+
+	packed.vertexData = packVertices(mesh.vertices, info.format);
+
+	packed.indexData.resize(mesh.indices.size() * indexTypeSize(info.indexType));
+	if (info.indexType == GL_UNSIGNED_SHORT)
+	{
+		GLushort *dst = (GLushort *)packed.indexData.data();
+		for (size_t i = 0; i < mesh.indices.size(); i++)
+			dst[i] = (GLushort)mesh.indices[i];
+	}
+	else if (!mesh.indices.empty())
+	{
+		memcpy(packed.indexData.data(), mesh.indices.data(), packed.indexData.size());
+	}
+	return packed;
+}
+
+// Cria VAO, VBO e EBO a partir de dados já codificados. info diz o formato dos
+// vértices e o tipo dos índices; os ponteiros podem apontar direto para um
+// arquivo mapeado em memória.
+inline GPUMesh uploadMeshData(const GPUMesh &info, const void *vertexData, size_t vertexBytes,
+															const void *indexData, size_t indexBytes)
+{
+	GPUMesh gpu = info;
+
+	glCreateVertexArrays(1, &gpu.VAO);
+	glCreateBuffers(1, &gpu.VBO);
+	glCreateBuffers(1, &gpu.EBO);
+
+	// Armazenamento imutável: a malha nunca é alterada depois do envio
+	if (vertexBytes)
+		glNamedBufferStorage(gpu.VBO, vertexBytes, vertexData, 0);
+	if (indexBytes)
+		glNamedBufferStorage(gpu.EBO, indexBytes, indexData, 0);
+
+	// O EBO fica registrado no VAO
+	glVertexArrayElementBuffer(gpu.VAO, gpu.EBO);
+
+	// Para cada atributo do vertice, o VAO guarda:
+	//  Localização no shader * (a localização dos atributos devem ser correspondentes no layout especificado no vertex shader)
+	//  Numero de valores que o atributo tem (por ex, 3 coordenadas xyz)
+	//  Tipo do dado
+	//  Se está normalizado (entre zero e um)
+	//  Deslocamento dentro do vértice, e o tamanho do vértice no binding do VBO
+	// Tudo isso vem do descritor do formato de vértice
+	applyVertexFormat(gpu.VAO, gpu.VBO, gpu.format);
+
+	return gpu;
+}
+
+// Codifica a malha no formato pedido e envia para a GPU
+inline GPUMesh uploadMesh(const IndexedMesh &mesh, const VertexFormat &format = makeVertexFormat(POSITION_FLOAT32, COLOR_FLOAT32))
+{
+	PackedMesh packed = packMesh(mesh, format);
+	return uploadMeshData(packed.info, packed.vertexData.data(), packed.vertexData.size(),
+												packed.indexData.data(), packed.indexData.size());
+}
+
+// Centraliza a malha na origem e ajusta a escala para que a maior dimensão
+// tenha tamanho 1 (o tamanho da pirâmide), para caber na tela
+inline glm::mat4 fitToUnitCube(const GPUMesh &gpu)
+{
+	glm::vec3 extent = gpu.boundsMax - gpu.boundsMin;
+	float size = std::max(extent.x, std::max(extent.y, extent.z));
+	float scale = size > 0.0f ? 1.0f / size : 1.0f;
+	glm::mat4 m = glm::scale(glm::mat4(1.0f), glm::vec3(scale));
+	return glm::translate(m, -(gpu.boundsMin + gpu.boundsMax) * 0.5f);
+}
+
+inline void deleteMesh(GPUMesh &gpu)
+{
+	glDeleteVertexArrays(1, &gpu.VAO);
+	glDeleteBuffers(1, &gpu.VBO);
+	glDeleteBuffers(1, &gpu.EBO);
+	gpu = GPUMesh();
+}
@@ -0,0 +1,278 @@
+/* MeshBatch.h - malhas estáticas num buffer único, desenhadas com multi-draw indireto
+ *
+ * MeshArena junta os vértices e índices de várias malhas (com a mesma
+ * codificação de vértice) num único VBO/EBO e um único VAO. Cada malha passa a
+ * ser só um intervalo da arena: firstIndex, indexCount e baseVertex.
+ *
+ * DrawBatch recebe a lista de objetos (malha, material, matriz), ordena por
+ * material e malha e gera um comando indireto por par (malha, material), com
+ * instanceCount = número de objetos daquela malha. Cada material é desenhado
+ * com um único glMultiDrawElementsIndirect, não importa quantos objetos tenha.
+ *
+ * No vertex shader (ARB_shader_draw_parameters):
+ *   gl_DrawIDARB                         -> dados do comando (matriz da malha)
+ *   gl_BaseInstanceARB + gl_InstanceID   -> dados do objeto (matriz de modelo)
+ * gl_DrawIDARB recomeça em 0 a cada chamada, por isso o primeiro comando do
+ * material vai num uniform (batchDrawOffset).
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <vector>
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <Mesh.h>
+#include <RenderState.h>
+
+// Bindings dos SSBOs do lote (o 0 é o das instâncias animadas)
+const GLuint BATCH_DRAW_BINDING = 1;
+const GLuint BATCH_OBJECT_BINDING = 2;
+const GLuint BATCH_VISIBLE_BINDING = 3; // objetos visíveis de cada comando, com culling
+
+// Layout fixo do GL para glMultiDrawElementsIndirect
+struct DrawElementsIndirectCommand
+{
+	GLuint count;
+	GLuint instanceCount;
+	GLuint firstIndex;
+	GLint baseVertex;
+	GLuint baseInstance;
+};
+
+// Uma malha dentro da arena
+struct ArenaMesh
+{
+	GLuint firstIndex = 0, indexCount = 0;
+	GLint baseVertex = 0;
+	glm::mat4 transform = glm::mat4(1.0f);													 // ajuste/dequantização da malha
+	glm::vec3 boundsMin = glm::vec3(0.0f), boundsMax = glm::vec3(0.0f); // caixa envolvente depois de transform
+};
+
+class MeshArena
+{
+public:
+	~MeshArena() { destroy(); }
+
+	// Copia as malhas (já na GPU) para a arena, direto de buffer para buffer.
+	// transforms[i] leva as posições armazenadas da malha i ao espaço do objeto.
+	// Os índices continuam locais a cada malha (baseVertex), então 16 bits bastam
+	// enquanto nenhuma malha passar de 65536 vértices.
+	bool build(const std::vector<GPUMesh> &sources, const std::vector<glm::mat4> &transforms)
+	{
+		destroy();
+		if (sources.empty())
+			return false;
+
+		const VertexFormat &format = sources[0].format;
+		size_t vertexCount = 0, indexCount = 0;
+		bool shortIndices = true;
+		for (const GPUMesh &source : sources)
+		{
+			if (source.format.position != format.position || source.format.color != format.color)
+			{
+				std::cout << "ERROR::MESH_BATCH::FORMAT_MISMATCH" << std::endl;
+				return false;
+			}
+			vertexCount += source.vertexCount;
+			indexCount += source.indexCount;
+			shortIndices = shortIndices && source.indexType == GL_UNSIGNED_SHORT;
+		}
+
+		GPUMesh &gpu = arena;
+		gpu.format = format;
+		gpu.vertexCount = (GLsizei)vertexCount;
+		gpu.indexCount = (GLsizei)indexCount;
+		gpu.indexType = shortIndices ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+		const size_t indexSize = indexTypeSize(gpu.indexType);
+
+		glCreateVertexArrays(1, &gpu.VAO);
+		glCreateBuffers(1, &gpu.VBO);
+		glCreateBuffers(1, &gpu.EBO);
+		glNamedBufferStorage(gpu.VBO, std::max<size_t>(vertexCount * format.stride, 1), nullptr, 0);
+		glNamedBufferStorage(gpu.EBO, std::max<size_t>(indexCount * indexSize, 1), nullptr, GL_DYNAMIC_STORAGE_BIT);
+		glVertexArrayElementBuffer(gpu.VAO, gpu.EBO);
+		applyVertexFormat(gpu.VAO, gpu.VBO, format);
+
+		size_t firstVertex = 0, firstIndex = 0;
+		for (size_t i = 0; i < sources.size(); i++)
+		{
+			const GPUMesh &source = sources[i];
+			ArenaMesh mesh;
+			mesh.firstIndex = (GLuint)firstIndex;
+			mesh.indexCount = (GLuint)source.indexCount;
+			mesh.baseVertex = (GLint)firstVertex;
+			mesh.transform = i < transforms.size() ? transforms[i] : glm::mat4(1.0f);
+			transformBounds(source, mesh);
+			meshes.push_back(mesh);
+
+			glCopyNamedBufferSubData(source.VBO, gpu.VBO, 0, firstVertex * format.stride, (GLsizeiptr)source.vertexCount * format.stride);
+			if (source.indexType == gpu.indexType)
+			{
+				glCopyNamedBufferSubData(source.EBO, gpu.EBO, 0, firstIndex * indexSize, (GLsizeiptr)source.indexCount * indexSize);
+			}
+			else
+			{
+				// Malha de 16 bits numa arena de 32: converte na CPU (só acontece uma vez)
+				std::vector<GLushort> narrow(source.indexCount);
+				glGetNamedBufferSubData(source.EBO, 0, narrow.size() * sizeof(GLushort), narrow.data());
+				std::vector<GLuint> wide(narrow.begin(), narrow.end());
+				glNamedBufferSubData(gpu.EBO, firstIndex * indexSize, wide.size() * sizeof(GLuint), wide.data());
+			}
+
+			firstVertex += source.vertexCount;
+			firstIndex += source.indexCount;
+		}
+		return true;
+	}
+
+	void destroy()
+	{
+		if (arena.VAO)
+			deleteMesh(arena);
+		meshes.clear();
+	}
+
+	const GPUMesh &gpu() const { return arena; }
+	const ArenaMesh &mesh(size_t i) const { return meshes[i]; }
+	size_t meshCount() const { return meshes.size(); }
+
+private:
+	// Caixa envolvente da malha depois da transformação (8 cantos transformados).
+	// source.bounds está nas posições originais e transform parte das armazenadas,
+	// então os cantos são quantizados de volta antes.
+	static void transformBounds(const GPUMesh &source, ArenaMesh &mesh)
+	{
+		for (int corner = 0; corner < 8; corner++)
+		{
+			glm::vec3 p((corner & 1) ? source.boundsMax.x : source.boundsMin.x,
+									(corner & 2) ? source.boundsMax.y : source.boundsMin.y,
+									(corner & 4) ? source.boundsMax.z : source.boundsMin.z);
+			p = (p - source.format.positionBias) / source.format.positionScale;
+			glm::vec3 q = glm::vec3(mesh.transform * glm::vec4(p, 1.0f));
+			mesh.boundsMin = corner == 0 ? q : glm::min(mesh.boundsMin, q);
+			mesh.boundsMax = corner == 0 ? q : glm::max(mesh.boundsMax, q);
+		}
+	}
+
+	GPUMesh arena;
+	std::vector<ArenaMesh> meshes;
+};
+
+// Um objeto da cena: qual malha da arena, com qual material, onde
+struct BatchObject
+{
+	uint32_t mesh = 0;
+	uint32_t material = 0;
+	glm::mat4 model = glm::mat4(1.0f);
+};
+
+class DrawBatch
+{
+public:
+	~DrawBatch() { destroy(); }
+
+	bool build(const MeshArena &arena, std::vector<BatchObject> objects)
+	{
+		destroy();
+		indexType = arena.gpu().indexType;
+
+		std::stable_sort(objects.begin(), objects.end(), [](const BatchObject &a, const BatchObject &b)
+										 { return a.material != b.material ? a.material < b.material : a.mesh < b.mesh; });
+
+		// Um comando por sequência de objetos com a mesma malha e material
+		std::vector<glm::mat4> drawData;
+		models.reserve(objects.size());
+		for (size_t i = 0; i < objects.size(); i++)
+		{
+			const BatchObject &object = objects[i];
+			models.push_back(object.model);
+			if (i > 0 && object.mesh == objects[i - 1].mesh && object.material == objects[i - 1].material)
+			{
+				commands.back().instanceCount++;
+				continue;
+			}
+
+			if (ranges.empty() || ranges.back().material != object.material)
+				ranges.push_back({object.material, (GLsizei)commands.size(), 0});
+			ranges.back().commandCount++;
+
+			const ArenaMesh &mesh = arena.mesh(object.mesh);
+			commands.push_back({mesh.indexCount, 1, mesh.firstIndex, mesh.baseVertex, (GLuint)i});
+			drawData.push_back(mesh.transform);
+			commandMeshes.push_back(object.mesh);
+		}
+		objectCount = objects.size();
+
+		// Os comandos podem ser reescritos depois (instanceCount), os dados são fixos
+		glCreateBuffers(1, &commandBuffer);
+		glNamedBufferStorage(commandBuffer, std::max<size_t>(commands.size(), 1) * sizeof(DrawElementsIndirectCommand), commands.data(), GL_DYNAMIC_STORAGE_BIT);
+		glCreateBuffers(1, &drawBuffer);
+		glNamedBufferStorage(drawBuffer, std::max<size_t>(drawData.size(), 1) * sizeof(glm::mat4), drawData.data(), 0);
+		glCreateBuffers(1, &objectBuffer);
+		glNamedBufferStorage(objectBuffer, std::max<size_t>(models.size(), 1) * sizeof(glm::mat4), models.data(), 0);
+		return true;
+	}
+
+	void destroy()
+	{
+		GLuint buffers[3] = {commandBuffer, drawBuffer, objectBuffer};
+		glDeleteBuffers(3, buffers);
+		commandBuffer = drawBuffer = objectBuffer = 0;
+		commands.clear();
+		commandMeshes.clear();
+		models.clear();
+		ranges.clear();
+		objectCount = 0;
+	}
+
+	// Desenha tudo: um glMultiDrawElementsIndirect por material. O VAO da arena
+	// e o programa devem estar em uso; bindMaterial troca o estado do material.
+	void draw(GLint drawOffsetLocation, const std::function<void(uint32_t material)> &bindMaterial = nullptr) const
+	{
+		RenderState &state = renderState();
+		state.bindBuffer(GL_DRAW_INDIRECT_BUFFER, commandBuffer);
+		state.bindBufferBase(GL_SHADER_STORAGE_BUFFER, BATCH_DRAW_BINDING, drawBuffer);
+		state.bindBufferBase(GL_SHADER_STORAGE_BUFFER, BATCH_OBJECT_BINDING, objectBuffer);
+		for (const MaterialRange &range : ranges)
+		{
+			if (bindMaterial)
+				bindMaterial(range.material);
+			state.uniform(drawOffsetLocation, (GLint)range.firstCommand);
+			glMultiDrawElementsIndirect(GL_TRIANGLES, indexType, (const void *)(range.firstCommand * sizeof(DrawElementsIndirectCommand)),
+																	range.commandCount, 0);
+		}
+	}
+
+	// Usados por passos que reescrevem os comandos (culling)
+	const std::vector<DrawElementsIndirectCommand> &commandList() const { return commands; }
+	uint32_t commandMesh(size_t command) const { return commandMeshes[command]; }
+	const glm::mat4 &objectModel(size_t object) const { return models[object]; } // na ordem dos comandos
+	GLuint commandBufferId() const { return commandBuffer; }
+	GLuint objectBufferId() const { return objectBuffer; }
+
+	size_t drawCallCount() const { return ranges.size(); }
+	size_t commandCount() const { return commands.size(); }
+	size_t objects() const { return objectCount; }
+
+private:
+	struct MaterialRange
+	{
+		uint32_t material;
+		GLsizei firstCommand, commandCount;
+	};
+
+	GLenum indexType = GL_UNSIGNED_INT;
+	GLuint commandBuffer = 0, drawBuffer = 0, objectBuffer = 0;
+	std::vector<DrawElementsIndirectCommand> commands;
+	std::vector<uint32_t> commandMeshes; // malha da arena de cada comando
+	std::vector<glm::mat4> models;			 // matriz de cada objeto, na ordem dos comandos
+	std::vector<MaterialRange> ranges;
+	size_t objectCount = 0;
+};
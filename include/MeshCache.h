@@ -0,0 +1,257 @@
+/* MeshCache.h - cache binário de malhas já processadas
+ *
+ * Depois de ler e otimizar uma malha (MeshLoader.h / MeshOptimizer.h), o
+ * resultado codificado para a GPU é gravado ao lado do arquivo original
+ * (arquivo.obj -> arquivo.obj.meshcache). Na próxima execução o cache é mapeado
+ * em memória e os blocos de vértices e índices vão direto para o glNamedBufferStorage,
+ * sem parsing e sem cópias intermediárias.
+ *
+ * Layout do arquivo (little endian, como a memória das plataformas suportadas):
+ *   MeshCacheHeader | ... | vértices (alinhado em 4096) | índices (alinhado em 4096)
+ *
+ * O cache é invalidado quando muda a versão do formato, o formato de vértice
+ * pedido ou o arquivo de origem. Para a origem, tamanho e data de modificação
+ * iguais bastam; se só a data mudou, o hash do conteúdo decide.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <Hash.h>
+#include <MappedFile.h>
+#include <Mesh.h>
+
+// Incrementar sempre que mudar o layout do arquivo ou o processamento da malha
+// (otimizador, quantização etc.)
+const uint32_t MESH_CACHE_VERSION = 1;
+const uint64_t MESH_CACHE_ALIGNMENT = 4096;
+const char MESH_CACHE_MAGIC[8] = {'H', '3', 'D', 'M', 'E', 'S', 'H', '\0'};
+
+struct MeshCacheAttribute
+{
+	uint32_t location, components, type, normalized, offset;
+};
+
+struct MeshCacheHeader
+{
+	char magic[8];
+	uint32_t version;
+	uint32_t headerSize;
+
+	// Identificação do arquivo de origem
+	uint64_t sourceSize;
+	int64_t sourceTime;
+	uint64_t sourceHash;
+
+	// Descritor do formato de vértice
+	uint32_t positionEncoding, colorEncoding;
+	uint32_t attributeCount, stride;
+	MeshCacheAttribute attributes[MAX_VERTEX_ATTRIBUTES];
+	float positionScale[3], positionBias[3];
+	float boundsMin[3], boundsMax[3];
+
+	// Blocos de dados
+	uint32_t vertexCount, indexCount, indexType, reserved;
+	uint64_t vertexOffset, vertexBytes;
+	uint64_t indexOffset, indexBytes;
+};
+
+// Tamanho e data de modificação do arquivo de origem
+inline bool sourceFileInfo(const std::string &path, uint64_t &size, int64_t &time)
+{
+	std::error_code ec;
+	size = (uint64_t)std::filesystem::file_size(path, ec);
+	if (ec)
+		return false;
+	auto stamp = std::filesystem::last_write_time(path, ec);
+	if (ec)
+		return false;
+	time = (int64_t)stamp.time_since_epoch().count();
+	return true;
+}
+
+inline uint64_t hashFile(const std::string &path)
+{
+	MappedFile file(path);
+	return file.isOpen() ? hashBytes(file.data(), file.size()) : 0;
+}
+
+inline std::string meshCachePath(const std::string &sourcePath)
+{
+	return sourcePath + ".meshcache";
+}
+
+// Cache aberto: o arquivo fica mapeado enquanto o objeto existir
+class MeshCache
+{
+public:
+	// Abre o cache da malha se ele for válido para a origem e o formato pedidos
+	bool open(const std::string &sourcePath, const VertexFormat &format)
+	{
+		uint64_t size;
+		int64_t time;
+		if (!sourceFileInfo(sourcePath, size, time))
+			return false;
+		if (!file.open(meshCachePath(sourcePath)) || file.size() < sizeof(MeshCacheHeader))
+			return false;
+
+		const MeshCacheHeader &h = header();
+		if (memcmp(h.magic, MESH_CACHE_MAGIC, sizeof(h.magic)) != 0 || h.version != MESH_CACHE_VERSION ||
+				h.headerSize != sizeof(MeshCacheHeader))
+			return invalidate("versao diferente");
+		if (h.positionEncoding != (uint32_t)format.position || h.colorEncoding != (uint32_t)format.color)
+			return invalidate("formato de vertice diferente");
+		if (!validLayout(h) || h.vertexBytes != (uint64_t)h.vertexCount * h.stride ||
+				h.indexBytes < (uint64_t)h.indexCount * indexTypeSize(h.indexType))
+			return invalidate("arquivo invalido");
+		// Comparações feitas sem somar offset + bytes, que poderia dar a volta
+		if (h.vertexOffset > file.size() || h.vertexBytes > file.size() - h.vertexOffset ||
+				h.indexOffset > file.size() || h.indexBytes > file.size() - h.indexOffset)
+			return invalidate("arquivo truncado");
+		if (h.sourceSize != size)
+			return invalidate("origem modificada");
+		if (h.sourceTime != time && hashFile(sourcePath) != h.sourceHash)
+			return invalidate("origem modificada");
+		return true;
+	}
+
+	// Cria VAO/VBO/EBO direto a partir do arquivo mapeado
+	GPUMesh upload() const
+	{
+		const MeshCacheHeader &h = header();
+		GPUMesh info;
+		info.vertexCount = (GLsizei)h.vertexCount;
+		info.indexCount = (GLsizei)h.indexCount;
+		info.indexType = (GLenum)h.indexType;
+		info.format.position = (PositionEncoding)h.positionEncoding;
+		info.format.color = (ColorEncoding)h.colorEncoding;
+		info.format.attributeCount = (int)h.attributeCount;
+		info.format.stride = (GLsizei)h.stride;
+		for (uint32_t i = 0; i < h.attributeCount; i++)
+		{
+			const MeshCacheAttribute &a = h.attributes[i];
+			info.format.attributes[i] = {a.location, (GLint)a.components, (GLenum)a.type, (GLboolean)a.normalized, a.offset};
+		}
+		info.format.positionScale = glm::vec3(h.positionScale[0], h.positionScale[1], h.positionScale[2]);
+		info.format.positionBias = glm::vec3(h.positionBias[0], h.positionBias[1], h.positionBias[2]);
+		info.boundsMin = glm::vec3(h.boundsMin[0], h.boundsMin[1], h.boundsMin[2]);
+		info.boundsMax = glm::vec3(h.boundsMax[0], h.boundsMax[1], h.boundsMax[2]);
+
+		return uploadMeshData(info, file.data() + h.vertexOffset, (size_t)h.vertexBytes,
+													file.data() + h.indexOffset, (size_t)h.indexBytes);
+	}
+
+	size_t size() const { return file.size(); }
+
+private:
+	const MeshCacheHeader &header() const { return *(const MeshCacheHeader *)file.data(); }
+
+	// O layout gravado tem que ser o que makeVertexFormat gera para as mesmas
+	// codificações (já conferidas), e o tipo de índice um dos dois usados
+	static bool validLayout(const MeshCacheHeader &h)
+	{
+		if (h.indexType != GL_UNSIGNED_SHORT && h.indexType != GL_UNSIGNED_INT)
+			return false;
+		const VertexFormat expected = makeVertexFormat((PositionEncoding)h.positionEncoding, (ColorEncoding)h.colorEncoding);
+		if (h.attributeCount != (uint32_t)expected.attributeCount || h.stride != (uint32_t)expected.stride)
+			return false;
+		for (uint32_t i = 0; i < h.attributeCount; i++)
+		{
+			const MeshCacheAttribute &a = h.attributes[i];
+			const VertexAttribute &e = expected.attributes[i];
+			if (a.location != e.location || a.components != (uint32_t)e.components || a.type != (uint32_t)e.type ||
+					a.normalized != (uint32_t)e.normalized || a.offset != e.offset)
+				return false;
+		}
+		return true;
+	}
+
+	bool invalidate(const char *reason)
+	{
+		std::cout << "Cache de malha invalido (" << reason << "), recriando" << std::endl;
+		file.close();
+		return false;
+	}
+
+	MappedFile file;
+};
+
+// Grava o cache da malha. O arquivo é escrito com outro nome e renomeado no
+// final, para que uma execução interrompida nunca deixe um cache pela metade.
+inline bool writeMeshCache(const std::string &sourcePath, const PackedMesh &mesh)
+{
+	MeshCacheHeader h;
+	memset(&h, 0, sizeof(h));
+	memcpy(h.magic, MESH_CACHE_MAGIC, sizeof(h.magic));
+	h.version = MESH_CACHE_VERSION;
+	h.headerSize = sizeof(MeshCacheHeader);
+
+	if (!sourceFileInfo(sourcePath, h.sourceSize, h.sourceTime))
+		return false;
+	h.sourceHash = hashFile(sourcePath);
+
+	const GPUMesh &info = mesh.info;
+	h.positionEncoding = (uint32_t)info.format.position;
+	h.colorEncoding = (uint32_t)info.format.color;
+	h.attributeCount = (uint32_t)info.format.attributeCount;
+	h.stride = (uint32_t)info.format.stride;
+	for (int i = 0; i < info.format.attributeCount; i++)
+	{
+		const VertexAttribute &a = info.format.attributes[i];
+		h.attributes[i] = {a.location, (uint32_t)a.components, (uint32_t)a.type, (uint32_t)a.normalized, a.offset};
+	}
+	for (int i = 0; i < 3; i++)
+	{
+		h.positionScale[i] = info.format.positionScale[i];
+		h.positionBias[i] = info.format.positionBias[i];
+		h.boundsMin[i] = info.boundsMin[i];
+		h.boundsMax[i] = info.boundsMax[i];
+	}
+
+	auto align = [](uint64_t offset)
+	{ return (offset + MESH_CACHE_ALIGNMENT - 1) / MESH_CACHE_ALIGNMENT * MESH_CACHE_ALIGNMENT; };
+	h.vertexCount = (uint32_t)info.vertexCount;
+	h.indexCount = (uint32_t)info.indexCount;
+	h.indexType = (uint32_t)info.indexType;
+	h.vertexOffset = align(sizeof(MeshCacheHeader));
+	h.vertexBytes = mesh.vertexData.size();
+	h.indexOffset = align(h.vertexOffset + h.vertexBytes);
+	h.indexBytes = mesh.indexData.size();
+
+	const std::string path = meshCachePath(sourcePath);
+	const std::string temporary = path + ".tmp";
+	FILE *f = fopen(temporary.c_str(), "wb");
+	if (!f)
+	{
+		std::cout << "ERROR::MESH_CACHE::WRITE_FAILED " << path << std::endl;
+		return false;
+	}
+
+	static const uint8_t zeros[MESH_CACHE_ALIGNMENT] = {0};
+	bool ok = fwrite(&h, sizeof(h), 1, f) == 1;
+	ok = ok && fwrite(zeros, 1, h.vertexOffset - sizeof(h), f) == h.vertexOffset - sizeof(h);
+	ok = ok && fwrite(mesh.vertexData.data(), 1, mesh.vertexData.size(), f) == mesh.vertexData.size();
+	ok = ok && fwrite(zeros, 1, h.indexOffset - h.vertexOffset - h.vertexBytes, f) == h.indexOffset - h.vertexOffset - h.vertexBytes;
+	ok = ok && fwrite(mesh.indexData.data(), 1, mesh.indexData.size(), f) == mesh.indexData.size();
+	ok = fclose(f) == 0 && ok;
+
+	std::error_code ec;
+	if (ok)
+		std::filesystem::rename(temporary, path, ec);
+	if (!ok || ec)
+	{
+		std::filesystem::remove(temporary, ec);
+		std::cout << "ERROR::MESH_CACHE::WRITE_FAILED " << path << std::endl;
+		return false;
+	}
+	return true;
+}
@@ -0,0 +1,1013 @@
+/* MeshLoader.h - leitura de malhas OBJ e PLY grandes
+ *
+ * O arquivo é mapeado em memória (MappedFile.h) e dividido em blocos que terminam
+ * em fim de linha. Cada bloco é lido por uma thread com um parser de números
+ * próprio (sem iostream e sem locale) e no final os blocos são juntados no
+ * formato indexado de Mesh.h.
+ *
+ * OBJ: linhas "v x y z [r g b]" e "f a b c ..." (também a/b/c, a//c e índices
+ *      negativos). Polígonos são triangulados em leque.
+ * PLY: ascii, binary_little_endian e binary_big_endian, com elemento "vertex"
+ *      (x, y, z e opcionalmente red, green, blue) e "face" (lista vertex_indices).
+ *
+ * Malhas sem cor recebem uma cor calculada a partir da posição.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <CpuProfiler.h>
+#include <MappedFile.h>
+#include <Mesh.h>
+#include <Parallel.h>
+
+// ---------------------------------------------------------------------------
+// Parser de texto
+
+inline bool isBlank(char c)
+{
+	return c == ' ' || c == '\t' || c == '\r';
+}
+
+inline const char *skipBlanks(const char *p, const char *end)
+{
+	while (p < end && isBlank(*p))
+		p++;
+	return p;
+}
+
+// Avança até o início da próxima linha
+inline const char *nextLine(const char *p, const char *end)
+{
+	const char *newline = (const char *)memchr(p, '\n', end - p);
+	return newline ? newline + 1 : end;
+}
+
+// Converte um número decimal (com sinal, fração e expoente opcionais). Não
+// depende do locale: o separador decimal é sempre '.'.
+inline bool parseNumber(const char *&p, const char *end, double &out)
+{
+	static const double powers[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+																	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+	const char *s = skipBlanks(p, end);
+	bool negative = false;
+	if (s < end && (*s == '-' || *s == '+'))
+		negative = *s++ == '-';
+
+	uint64_t mantissa = 0;
+	int exponent = 0, digits = 0, significant = 0;
+	while (s < end && (unsigned)(*s - '0') < 10)
+	{
+		if (significant < 19)
+		{
+			mantissa = mantissa * 10 + (*s - '0');
+			if (mantissa)
+				significant++;
+		}
+		else
+		{
+			exponent++;
+		}
+		s++;
+		digits++;
+	}
+	if (s < end && *s == '.')
+	{
+		s++;
+		while (s < end && (unsigned)(*s - '0') < 10)
+		{
+			if (significant < 19)
+			{
+				mantissa = mantissa * 10 + (*s - '0');
+				exponent--;
+				if (mantissa)
+					significant++;
+			}
+			s++;
+			digits++;
+		}
+	}
+	if (digits == 0)
+		return false;
+
+	if (s < end && (*s == 'e' || *s == 'E'))
+	{
+		const char *e = s + 1;
+		bool negativeExponent = false;
+		if (e < end && (*e == '-' || *e == '+'))
+			negativeExponent = *e++ == '-';
+		if (e < end && (unsigned)(*e - '0') < 10)
+		{
+			int value = 0;
+			while (e < end && (unsigned)(*e - '0') < 10)
+			{
+				if (value < 10000)
+					value = value * 10 + (*e - '0');
+				e++;
+			}
+			exponent += negativeExponent ? -value : value;
+			s = e;
+		}
+	}
+
+	double value = (double)mantissa;
+	if (exponent != 0 && mantissa != 0)
+	{
+		if (exponent > 0)
+			value = exponent <= 22 ? value * powers[exponent] : value * std::pow(10.0, exponent);
+		else
+			value = exponent >= -22 ? value / powers[-exponent] : value * std::pow(10.0, exponent);
+	}
+
+	out = negative ? -value : value;
+	p = s;
+	return true;
+}
+
+inline bool parseFloat(const char *&p, const char *end, float &out)
+{
+	double value;
+	if (!parseNumber(p, end, value))
+		return false;
+	out = (float)value;
+	return true;
+}
+
+inline bool parseInteger(const char *&p, const char *end, long long &out)
+{
+	const char *s = skipBlanks(p, end);
+	bool negative = false;
+	if (s < end && (*s == '-' || *s == '+'))
+		negative = *s++ == '-';
+	if (s >= end || (unsigned)(*s - '0') >= 10)
+		return false;
+	long long value = 0;
+	while (s < end && (unsigned)(*s - '0') < 10)
+		value = value * 10 + (*s++ - '0');
+	out = negative ? -value : value;
+	p = s;
+	return true;
+}
+
+// Divide [begin, end) em até count blocos, cada um terminando em fim de linha
+inline std::vector<std::pair<const char *, const char *>> splitLines(const char *begin, const char *end, size_t count)
+{
+	std::vector<std::pair<const char *, const char *>> chunks;
+	size_t size = end - begin;
+	const char *start = begin;
+	for (size_t i = 1; i <= count && start < end; i++)
+	{
+		const char *stop = i == count ? end : begin + size * i / count;
+		if (stop < start)
+			stop = start;
+		stop = stop < end ? nextLine(stop, end) : end;
+		if (stop > start)
+			chunks.push_back({start, stop});
+		start = stop;
+	}
+	return chunks;
+}
+
+// Blocos de no mínimo 1 MB, para não agendar uma tarefa por poucos bytes
+inline size_t chunkCountFor(size_t bytes)
+{
+	size_t byThreads = workerThreadCount();
+	size_t bySize = bytes / (1 << 20) + 1;
+	return std::min(byThreads, bySize);
+}
+
+// Cor para malhas sem cor: a posição normalizada na caixa envolvente
+inline void assignPositionColors(IndexedMesh &mesh)
+{
+	if (mesh.vertices.empty())
+		return;
+	glm::vec3 minimum = mesh.vertices[0].position, maximum = minimum;
+	for (const Vertex &v : mesh.vertices)
+	{
+		minimum = glm::min(minimum, v.position);
+		maximum = glm::max(maximum, v.position);
+	}
+	glm::vec3 extent = maximum - minimum;
+	for (int i = 0; i < 3; i++)
+		if (extent[i] <= 0.0f)
+			extent[i] = 1.0f;
+	for (Vertex &v : mesh.vertices)
+		v.color = glm::vec3(0.2f) + 0.8f * ((v.position - minimum) / extent);
+}
+
+// Junta listas de índices (uma por bloco) em mesh.indices, em paralelo
+inline void mergeIndexChunks(const std::vector<std::vector<GLuint>> &chunks, IndexedMesh &mesh)
+{
+	std::vector<size_t> offsets(chunks.size() + 1, 0);
+	for (size_t c = 0; c < chunks.size(); c++)
+		offsets[c + 1] = offsets[c] + chunks[c].size();
+	mesh.indices.resize(offsets.back());
+	runParallel(chunks.size(), [&](size_t c)
+							{ std::copy(chunks[c].begin(), chunks[c].end(), mesh.indices.begin() + offsets[c]); });
+}
+
+// ---------------------------------------------------------------------------
+// OBJ
+
+struct ObjChunk
+{
+	std::vector<Vertex> vertices;
+	size_t coloredVertices = 0;
+	std::vector<long long> indices; // 0-based; os listados em relative são locais ao bloco
+	std::vector<size_t> relative;
+	const char *errorAt = nullptr;
+};
+
+inline void parseObjChunk(const char *p, const char *end, ObjChunk &chunk)
+{
+	std::vector<long long> polygon;
+	std::vector<bool> polygonRelative;
+
+	while (p < end)
+	{
+		const char *line = skipBlanks(p, end);
+		const char *lineEnd = (const char *)memchr(line, '\n', end - line);
+		if (!lineEnd)
+			lineEnd = end;
+		p = lineEnd < end ? lineEnd + 1 : end;
+
+		if (line + 1 >= lineEnd || !isBlank(line[1]))
+			continue; // linha vazia ou comando com mais de uma letra (vn, vt, usemtl...)
+
+		if (line[0] == 'v')
+		{
+			const char *s = line + 1;
+			Vertex v;
+			if (!parseFloat(s, lineEnd, v.position.x) || !parseFloat(s, lineEnd, v.position.y) ||
+					!parseFloat(s, lineEnd, v.position.z))
+			{
+				chunk.errorAt = line;
+				return;
+			}
+			// Extensão comum do formato: cor do vértice logo após a posição
+			if (parseFloat(s, lineEnd, v.color.r) && parseFloat(s, lineEnd, v.color.g) && parseFloat(s, lineEnd, v.color.b))
+				chunk.coloredVertices++;
+			else
+				v.color = glm::vec3(1.0f);
+			chunk.vertices.push_back(v);
+		}
+		else if (line[0] == 'f')
+		{
+			const char *s = line + 1;
+			polygon.clear();
+			polygonRelative.clear();
+			long long index;
+			while (parseInteger(s, lineEnd, index))
+			{
+				if (index == 0)
+				{
+					chunk.errorAt = line;
+					return;
+				}
+				if (index > 0)
+				{
+					polygon.push_back(index - 1);
+					polygonRelative.push_back(false);
+				}
+				else
+				{
+					polygon.push_back((long long)chunk.vertices.size() + index);
+					polygonRelative.push_back(true);
+				}
+				// Ignora coordenada de textura e normal (a/b/c)
+				while (s < lineEnd && !isBlank(*s))
+					s++;
+			}
+			if (polygon.size() < 3)
+			{
+				chunk.errorAt = line;
+				return;
+			}
+			for (size_t i = 1; i + 1 < polygon.size(); i++)
+			{
+				const size_t corners[3] = {0, i, i + 1};
+				for (size_t corner : corners)
+				{
+					if (polygonRelative[corner])
+						chunk.relative.push_back(chunk.indices.size());
+					chunk.indices.push_back(polygon[corner]);
+				}
+			}
+		}
+	}
+}
+
+inline bool loadObj(const MappedFile &file, IndexedMesh &mesh, std::string &error)
+{
+	auto ranges = splitLines(file.chars(), file.chars() + file.size(), chunkCountFor(file.size()));
+	std::vector<ObjChunk> chunks(ranges.size());
+	runParallel(ranges.size(), [&](size_t c)
+							{ parseObjChunk(ranges[c].first, ranges[c].second, chunks[c]); });
+
+	// Posição de cada bloco no resultado final
+	std::vector<size_t> vertexBase(chunks.size() + 1, 0), indexBase(chunks.size() + 1, 0);
+	size_t colored = 0;
+	for (size_t c = 0; c < chunks.size(); c++)
+	{
+		if (chunks[c].errorAt)
+		{
+			const char *lineEnd = (const char *)memchr(chunks[c].errorAt, '\n', file.chars() + file.size() - chunks[c].errorAt);
+			error = "linha invalida: " + std::string(chunks[c].errorAt, lineEnd ? lineEnd : file.chars() + file.size());
+			return false;
+		}
+		vertexBase[c + 1] = vertexBase[c] + chunks[c].vertices.size();
+		indexBase[c + 1] = indexBase[c] + chunks[c].indices.size();
+		colored += chunks[c].coloredVertices;
+	}
+
+	const size_t vertexCount = vertexBase.back();
+	if (vertexCount > 0xffffffffull)
+	{
+		error = "vertices demais para indices de 32 bits";
+		return false;
+	}
+	mesh.vertices.resize(vertexCount);
+	mesh.indices.resize(indexBase.back());
+
+	std::vector<char> badIndex(chunks.size(), 0);
+	runParallel(chunks.size(), [&](size_t c)
+							{
+		ObjChunk &chunk = chunks[c];
+		std::copy(chunk.vertices.begin(), chunk.vertices.end(), mesh.vertices.begin() + vertexBase[c]);
+		for (size_t slot : chunk.relative)
+			chunk.indices[slot] += (long long)vertexBase[c];
+		GLuint *out = mesh.indices.data() + indexBase[c];
+		for (size_t i = 0; i < chunk.indices.size(); i++)
+		{
+			long long index = chunk.indices[i];
+			if (index < 0 || index >= (long long)vertexCount)
+			{
+				badIndex[c] = 1;
+				index = 0;
+			}
+			out[i] = (GLuint)index;
+		}
+		std::vector<Vertex>().swap(chunk.vertices);
+		std::vector<long long>().swap(chunk.indices); });
+
+	if (std::find(badIndex.begin(), badIndex.end(), 1) != badIndex.end())
+	{
+		error = "face com indice fora do intervalo de vertices";
+		return false;
+	}
+	if (colored != vertexCount)
+		assignPositionColors(mesh);
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+// PLY
+
+enum PlyType
+{
+	PLY_INVALID,
+	PLY_INT8,
+	PLY_UINT8,
+	PLY_INT16,
+	PLY_UINT16,
+	PLY_INT32,
+	PLY_UINT32,
+	PLY_FLOAT32,
+	PLY_FLOAT64
+};
+
+inline PlyType parsePlyType(const std::string &name)
+{
+	if (name == "char" || name == "int8")
+		return PLY_INT8;
+	if (name == "uchar" || name == "uint8")
+		return PLY_UINT8;
+	if (name == "short" || name == "int16")
+		return PLY_INT16;
+	if (name == "ushort" || name == "uint16")
+		return PLY_UINT16;
+	if (name == "int" || name == "int32")
+		return PLY_INT32;
+	if (name == "uint" || name == "uint32")
+		return PLY_UINT32;
+	if (name == "float" || name == "float32")
+		return PLY_FLOAT32;
+	if (name == "double" || name == "float64")
+		return PLY_FLOAT64;
+	return PLY_INVALID;
+}
+
+inline size_t plyTypeSize(PlyType type)
+{
+	static const size_t sizes[] = {0, 1, 1, 2, 2, 4, 4, 4, 8};
+	return sizes[type];
+}
+
+struct PlyProperty
+{
+	std::string name;
+	PlyType type = PLY_INVALID;
+	PlyType countType = PLY_INVALID; // != PLY_INVALID para listas
+};
+
+struct PlyElement
+{
+	std::string name;
+	size_t count = 0;
+	std::vector<PlyProperty> properties;
+
+	int find(const char *name) const
+	{
+		for (size_t i = 0; i < properties.size(); i++)
+			if (properties[i].name == name)
+				return (int)i;
+		return -1;
+	}
+	bool fixedSize() const
+	{
+		for (const PlyProperty &p : properties)
+			if (p.countType != PLY_INVALID)
+				return false;
+		return true;
+	}
+	size_t stride() const
+	{
+		size_t total = 0;
+		for (const PlyProperty &p : properties)
+			total += plyTypeSize(p.type);
+		return total;
+	}
+	// Menor tamanho possível de um registro em bytes: no binário, listas
+	// vazias; no ascii, um dígito e um separador por propriedade
+	size_t minimumRecordSize(bool ascii) const
+	{
+		size_t total = 0;
+		for (const PlyProperty &p : properties)
+			total += ascii ? 2 : plyTypeSize(p.countType != PLY_INVALID ? p.countType : p.type);
+		return total;
+	}
+};
+
+inline double readPlyBinary(const uint8_t *p, PlyType type, bool bigEndian)
+{
+	uint8_t b[8];
+	size_t n = plyTypeSize(type);
+	for (size_t i = 0; i < n; i++)
+		b[i] = bigEndian ? p[n - 1 - i] : p[i];
+
+	switch (type)
+	{
+	case PLY_INT8:
+		return (double)(int8_t)b[0];
+	case PLY_UINT8:
+		return (double)b[0];
+	case PLY_INT16:
+	{
+		int16_t v;
+		memcpy(&v, b, 2);
+		return v;
+	}
+	case PLY_UINT16:
+	{
+		uint16_t v;
+		memcpy(&v, b, 2);
+		return v;
+	}
+	case PLY_INT32:
+	{
+		int32_t v;
+		memcpy(&v, b, 4);
+		return v;
+	}
+	case PLY_UINT32:
+	{
+		uint32_t v;
+		memcpy(&v, b, 4);
+		return v;
+	}
+	case PLY_FLOAT32:
+	{
+		float v;
+		memcpy(&v, b, 4);
+		return v;
+	}
+	case PLY_FLOAT64:
+	{
+		double v;
+		memcpy(&v, b, 8);
+		return v;
+	}
+	default:
+		return 0.0;
+	}
+}
+
+// Fator para levar uma componente de cor inteira para [0, 1]
+inline float plyColorScale(PlyType type)
+{
+	switch (type)
+	{
+	case PLY_UINT8:
+	case PLY_INT8:
+		return 1.0f / 255.0f;
+	case PLY_UINT16:
+	case PLY_INT16:
+		return 1.0f / 65535.0f;
+	default:
+		return 1.0f;
+	}
+}
+
+// Colunas do elemento "vertex" que interessam
+struct PlyVertexLayout
+{
+	int position[3] = {-1, -1, -1};
+	int color[3] = {-1, -1, -1};
+	float colorScale = 1.0f;
+
+	bool hasColor() const { return color[0] >= 0 && color[1] >= 0 && color[2] >= 0; }
+};
+
+// Propriedades por vértice lidas (os valores de um vértice ficam num array fixo)
+const size_t PLY_MAX_VERTEX_PROPERTIES = 32;
+
+inline PlyVertexLayout makePlyVertexLayout(const PlyElement &element)
+{
+	PlyVertexLayout layout;
+	const char *positionNames[3] = {"x", "y", "z"};
+	const char *colorNames[3] = {"red", "green", "blue"};
+	for (int i = 0; i < 3; i++)
+	{
+		layout.position[i] = element.find(positionNames[i]);
+		layout.color[i] = element.find(colorNames[i]);
+	}
+	if (layout.hasColor())
+		layout.colorScale = plyColorScale(element.properties[layout.color[0]].type);
+	return layout;
+}
+
+inline void storePlyVertex(const double *values, const PlyVertexLayout &layout, Vertex &v)
+{
+	v.position = glm::vec3((float)values[layout.position[0]], (float)values[layout.position[1]], (float)values[layout.position[2]]);
+	if (layout.hasColor())
+		v.color = glm::vec3((float)values[layout.color[0]], (float)values[layout.color[1]], (float)values[layout.color[2]]) * layout.colorScale;
+	else
+		v.color = glm::vec3(1.0f);
+}
+
+// Triangula um polígono em leque, acrescentando em out
+inline bool appendPolygon(const long long *polygon, size_t count, size_t vertexCount, std::vector<GLuint> &out)
+{
+	for (size_t i = 0; i < count; i++)
+		if (polygon[i] < 0 || polygon[i] >= (long long)vertexCount)
+			return false;
+	for (size_t i = 1; i + 1 < count; i++)
+	{
+		out.push_back((GLuint)polygon[0]);
+		out.push_back((GLuint)polygon[i]);
+		out.push_back((GLuint)polygon[i + 1]);
+	}
+	return true;
+}
+
+// Lê count linhas ascii a partir de p, em paralelo. parseLine recebe a linha e
+// o índice do bloco; devolve false em caso de erro. Retorna o fim da última linha.
+template <typename ParseLine>
+const char *parsePlyAsciiLines(const char *p, const char *end, size_t count, size_t chunkCount, ParseLine parseLine, bool &ok)
+{
+	// Localiza o fim de cada linha (busca sequencial, mas só com memchr)
+	std::vector<const char *> starts;
+	starts.reserve(chunkCount + 1);
+	size_t perChunk = count / chunkCount + 1;
+	const char *s = p;
+	for (size_t line = 0; line < count; line++)
+	{
+		if (line % perChunk == 0)
+			starts.push_back(s);
+		if (s >= end)
+		{
+			ok = false;
+			return end;
+		}
+		s = nextLine(s, end);
+	}
+	starts.push_back(s);
+
+	std::vector<char> failed(starts.size() - 1, 0);
+	runParallel(starts.size() - 1, [&](size_t c)
+							{
+		const char *q = starts[c];
+		while (q < starts[c + 1] && !failed[c])
+		{
+			const char *lineEnd = (const char *)memchr(q, '\n', starts[c + 1] - q);
+			if (!lineEnd)
+				lineEnd = starts[c + 1];
+			if (!parseLine(q, lineEnd, c))
+				failed[c] = 1;
+			q = lineEnd < starts[c + 1] ? lineEnd + 1 : lineEnd;
+		} });
+	ok = std::find(failed.begin(), failed.end(), 1) == failed.end();
+	return s;
+}
+
+inline bool loadPly(const MappedFile &file, IndexedMesh &mesh, std::string &error)
+{
+	const char *begin = file.chars();
+	const char *end = begin + file.size();
+
+	// Cabeçalho
+	const char *p = begin;
+	std::string format;
+	std::vector<PlyElement> elements;
+	bool headerDone = false;
+	while (p < end && !headerDone)
+	{
+		const char *lineEnd = (const char *)memchr(p, '\n', end - p);
+		if (!lineEnd)
+			lineEnd = end;
+		std::string line(p, lineEnd);
+		if (!line.empty() && line.back() == '\r')
+			line.pop_back();
+		p = lineEnd < end ? lineEnd + 1 : end;
+
+		std::vector<std::string> words;
+		size_t start = 0;
+		while (start < line.size())
+		{
+			size_t space = line.find(' ', start);
+			if (space == std::string::npos)
+				space = line.size();
+			if (space > start)
+				words.push_back(line.substr(start, space - start));
+			start = space + 1;
+		}
+		if (words.empty())
+			continue;
+
+		if (words[0] == "format" && words.size() >= 2)
+			format = words[1];
+		else if (words[0] == "element" && words.size() >= 3)
+		{
+			PlyElement element;
+			element.name = words[1];
+			element.count = std::strtoull(words[2].c_str(), nullptr, 10);
+			elements.push_back(element);
+		}
+		else if (words[0] == "property" && !elements.empty())
+		{
+			PlyProperty property;
+			if (words.size() >= 5 && words[1] == "list")
+			{
+				property.countType = parsePlyType(words[2]);
+				property.type = parsePlyType(words[3]);
+				property.name = words[4];
+			}
+			else if (words.size() >= 3)
+			{
+				property.type = parsePlyType(words[1]);
+				property.name = words[2];
+			}
+			if (property.type == PLY_INVALID || (words[1] == "list" && property.countType == PLY_INVALID))
+			{
+				error = "propriedade invalida: " + line;
+				return false;
+			}
+			elements.back().properties.push_back(property);
+		}
+		else if (words[0] == "end_header")
+			headerDone = true;
+	}
+	if (!headerDone)
+	{
+		error = "cabecalho PLY incompleto";
+		return false;
+	}
+
+	const bool ascii = format == "ascii";
+	const bool bigEndian = format == "binary_big_endian";
+	if (!ascii && !bigEndian && format != "binary_little_endian")
+	{
+		error = "formato PLY desconhecido: " + format;
+		return false;
+	}
+
+	bool hasColor = false;
+	std::vector<std::vector<GLuint>> faceChunks;
+
+	for (const PlyElement &element : elements)
+	{
+		const bool isVertex = element.name == "vertex";
+		const bool isFace = element.name == "face";
+		const int faceList = isFace ? std::max(element.find("vertex_indices"), element.find("vertex_index")) : -1;
+
+		// A contagem vem do cabeçalho: confere com o que resta do arquivo antes
+		// de alocar qualquer coisa por ela (a última linha ascii pode não ter '\n')
+		const size_t minimumSize = element.minimumRecordSize(ascii);
+		if (minimumSize > 0 && element.count > ((size_t)(end - p) + (ascii ? 1 : 0)) / minimumSize)
+		{
+			error = "arquivo truncado no elemento " + element.name;
+			return false;
+		}
+
+		PlyVertexLayout layout;
+		if (isVertex)
+		{
+			layout = makePlyVertexLayout(element);
+			if (layout.position[0] < 0 || layout.position[1] < 0 || layout.position[2] < 0 || !element.fixedSize())
+			{
+				error = "elemento vertex sem x, y, z";
+				return false;
+			}
+			if (element.properties.size() > PLY_MAX_VERTEX_PROPERTIES)
+			{
+				error = "elemento vertex com mais de " + std::to_string(PLY_MAX_VERTEX_PROPERTIES) + " propriedades";
+				return false;
+			}
+			hasColor = layout.hasColor();
+			mesh.vertices.resize(element.count);
+		}
+		if (isFace && (faceList < 0 || element.properties[faceList].countType == PLY_INVALID))
+		{
+			error = "elemento face sem lista vertex_indices";
+			return false;
+		}
+
+		if (ascii)
+		{
+			size_t chunkCount = std::max<size_t>(1, std::min(chunkCountFor(end - p), element.count / 4096 + 1));
+			bool ok = true;
+			if (isVertex)
+			{
+				// Índice do vértice = primeiro vértice do bloco + linhas já lidas no bloco
+				std::vector<size_t> next(chunkCount, 0);
+				size_t perChunk = element.count / chunkCount + 1;
+				const size_t columns = element.properties.size();
+				p = parsePlyAsciiLines(p, end, element.count, chunkCount, [&](const char *q, const char *lineEnd, size_t c)
+															 {
+					double values[PLY_MAX_VERTEX_PROPERTIES];
+					for (size_t i = 0; i < columns; i++)
+						if (!parseNumber(q, lineEnd, values[i]))
+							return false;
+					storePlyVertex(values, layout, mesh.vertices[c * perChunk + next[c]++]);
+					return true; }, ok);
+			}
+			else if (isFace)
+			{
+				faceChunks.assign(chunkCount, std::vector<GLuint>());
+				const size_t vertexCount = mesh.vertices.size();
+				p = parsePlyAsciiLines(p, end, element.count, chunkCount, [&](const char *q, const char *lineEnd, size_t c)
+															 {
+					long long polygon[64];
+					for (int prop = 0; prop < (int)element.properties.size(); prop++)
+					{
+						long long count;
+						if (element.properties[prop].countType != PLY_INVALID)
+						{
+							if (!parseInteger(q, lineEnd, count))
+								return false;
+						}
+						else
+						{
+							count = 1;
+						}
+						for (long long i = 0; i < count; i++)
+						{
+							double value;
+							if (!parseNumber(q, lineEnd, value))
+								return false;
+							if (prop == faceList && i < 64)
+								polygon[i] = (long long)value;
+						}
+						if (prop == faceList && (count < 3 || count > 64 || !appendPolygon(polygon, (size_t)count, vertexCount, faceChunks[c])))
+							return false;
+					}
+					return true; }, ok);
+			}
+			else
+			{
+				for (size_t i = 0; i < element.count && p < end; i++)
+					p = nextLine(p, end);
+			}
+			if (!ok)
+			{
+				error = "dados invalidos no elemento " + element.name;
+				return false;
+			}
+			continue;
+		}
+
+		// Binário: elementos de tamanho fixo são lidos direto por posição
+		const uint8_t *data = (const uint8_t *)p;
+		const uint8_t *dataEnd = (const uint8_t *)end;
+		if (element.fixedSize())
+		{
+			// O tamanho já foi conferido no começo do elemento
+			const size_t stride = element.stride();
+			if (isVertex)
+			{
+				std::vector<size_t> offsets;
+				size_t offset = 0;
+				for (const PlyProperty &property : element.properties)
+				{
+					offsets.push_back(offset);
+					offset += plyTypeSize(property.type);
+				}
+				size_t chunkCount = chunkCountFor(stride * element.count);
+				runParallel(chunkCount, [&](size_t c)
+										{
+					size_t first = element.count * c / chunkCount, last = element.count * (c + 1) / chunkCount;
+					double values[PLY_MAX_VERTEX_PROPERTIES] = {0};
+					for (size_t v = first; v < last; v++)
+					{
+						const uint8_t *record = data + v * stride;
+						for (size_t i = 0; i < element.properties.size(); i++)
+							values[i] = readPlyBinary(record + offsets[i], element.properties[i].type, bigEndian);
+						storePlyVertex(values, layout, mesh.vertices[v]);
+					} });
+			}
+			p = (const char *)(data + stride * element.count);
+			continue;
+		}
+
+		// Caso comum em scans: só a lista de índices e todas as faces com o mesmo
+		// número de vértices. Os registros têm tamanho fixo e são lidos em paralelo.
+		if (isFace && element.properties.size() == 1 && element.count > 0 &&
+				data + plyTypeSize(element.properties[0].countType) <= dataEnd)
+		{
+			const PlyProperty &property = element.properties[0];
+			const size_t countSize = plyTypeSize(property.countType), indexSize = plyTypeSize(property.type);
+			const size_t corners = (size_t)readPlyBinary(data, property.countType, bigEndian);
+			const size_t recordSize = countSize + corners * indexSize;
+			if (corners >= 3 && corners <= 64 && (size_t)(dataEnd - data) / recordSize >= element.count)
+			{
+				size_t chunkCount = chunkCountFor(recordSize * element.count);
+				faceChunks.assign(chunkCount, std::vector<GLuint>());
+				// failed: 1 = face com outro tamanho, 2 = índice fora do intervalo.
+				// Depois de uma face com outro tamanho os blocos seguintes leem
+				// posições erradas: todos param e os índices deles não valem nada.
+				std::vector<char> failed(chunkCount, 0);
+				std::atomic<bool> mismatch{false};
+				runParallel(chunkCount, [&](size_t c)
+										{
+					size_t first = element.count * c / chunkCount, last = element.count * (c + 1) / chunkCount;
+					faceChunks[c].reserve((last - first) * (corners - 2) * 3);
+					long long polygon[64];
+					for (size_t f = first; f < last && !failed[c] && !mismatch.load(std::memory_order_relaxed); f++)
+					{
+						const uint8_t *record = data + f * recordSize;
+						if ((size_t)readPlyBinary(record, property.countType, bigEndian) != corners)
+						{
+							failed[c] = 1;
+							mismatch.store(true, std::memory_order_relaxed);
+							break;
+						}
+						for (size_t i = 0; i < corners; i++)
+							polygon[i] = (long long)readPlyBinary(record + countSize + i * indexSize, property.type, bigEndian);
+						if (!appendPolygon(polygon, corners, mesh.vertices.size(), faceChunks[c]))
+							failed[c] = 2;
+					} });
+
+				// Só sem nenhuma face de outro tamanho todos os blocos leram registros
+				// alinhados e um índice fora do intervalo é mesmo erro do arquivo
+				if (!mismatch.load())
+				{
+					if (std::find(failed.begin(), failed.end(), 2) != failed.end())
+					{
+						error = "face com indice fora do intervalo de vertices";
+						return false;
+					}
+					p = (const char *)(data + recordSize * element.count);
+					continue;
+				}
+				// Faces com tamanhos diferentes: cai na leitura sequencial abaixo
+				// (que refaz faceChunks do começo)
+			}
+		}
+
+		// Elementos com listas (faces): leitura sequencial, o tamanho de cada
+		// registro só é conhecido depois de ler a contagem. Outros elementos com
+		// listas só são pulados (as faces já lidas ficam em faceChunks).
+		if (isFace)
+		{
+			faceChunks.assign(1, std::vector<GLuint>());
+			faceChunks[0].reserve(element.count * 3);
+		}
+		long long polygon[64];
+		for (size_t f = 0; f < element.count; f++)
+		{
+			for (int prop = 0; prop < (int)element.properties.size(); prop++)
+			{
+				const PlyProperty &property = element.properties[prop];
+				size_t count = 1;
+				if (property.countType != PLY_INVALID)
+				{
+					if (data + plyTypeSize(property.countType) > dataEnd)
+					{
+						error = "arquivo truncado no elemento " + element.name;
+						return false;
+					}
+					count = (size_t)readPlyBinary(data, property.countType, bigEndian);
+					data += plyTypeSize(property.countType);
+				}
+				const size_t size = plyTypeSize(property.type);
+				if (data + size * count > dataEnd)
+				{
+					error = "arquivo truncado no elemento " + element.name;
+					return false;
+				}
+				if (prop == faceList)
+				{
+					if (count < 3 || count > 64)
+					{
+						error = "face com numero de vertices invalido";
+						return false;
+					}
+					for (size_t i = 0; i < count; i++)
+						polygon[i] = (long long)readPlyBinary(data + i * size, property.type, bigEndian);
+					if (!appendPolygon(polygon, count, mesh.vertices.size(), faceChunks[0]))
+					{
+						error = "face com indice fora do intervalo de vertices";
+						return false;
+					}
+				}
+				data += size * count;
+			}
+		}
+		p = (const char *)data;
+	}
+
+	mergeIndexChunks(faceChunks, mesh);
+	if (!hasColor)
+		assignPositionColors(mesh);
+	return true;
+}
+
+// ---------------------------------------------------------------------------
+
+inline bool hasExtension(const std::string &path, const char *extension)
+{
+	size_t n = strlen(extension);
+	if (path.size() < n)
+		return false;
+	for (size_t i = 0; i < n; i++)
+		if (tolower((unsigned char)path[path.size() - n + i]) != extension[i])
+			return false;
+	return true;
+}
+
+// Carrega um arquivo .obj ou .ply. Em caso de erro imprime a mensagem e
+// retorna false.
+inline bool loadMesh(const std::string &path, IndexedMesh &mesh)
+{
+	ProfileZone zone("carregar malha");
+	auto start = std::chrono::steady_clock::now();
+
+	MappedFile file;
+	if (!file.open(path))
+	{
+		std::cout << "ERROR::MESH::FILE_NOT_FOUND " << path << std::endl;
+		return false;
+	}
+
+	mesh = IndexedMesh();
+	std::string error;
+	bool ok;
+	if (hasExtension(path, ".obj"))
+		ok = loadObj(file, mesh, error);
+	else if (hasExtension(path, ".ply"))
+		ok = loadPly(file, mesh, error);
+	else
+	{
+		ok = false;
+		error = "extensao nao suportada (use .obj ou .ply)";
+	}
+
+	if (!ok)
+	{
+		std::cout << "ERROR::MESH::LOAD_FAILED " << path << "\n"
+							<< error << std::endl;
+		mesh = IndexedMesh();
+		return false;
+	}
+
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	std::cout << "Malha " << path << ": " << mesh.vertices.size() << " vertices, " << mesh.indices.size() / 3
+						<< " triangulos, " << file.size() / (1024.0 * 1024.0) << " MB em " << seconds * 1000.0 << " ms ("
+						<< file.size() / (1024.0 * 1024.0) / std::max(seconds, 1e-9) << " MB/s, "
+						<< chunkCountFor(file.size()) << " threads)" << std::endl;
+	return true;
+}
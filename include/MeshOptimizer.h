@@ -0,0 +1,357 @@
+/* MeshOptimizer.h - reordenação de índices e vértices antes do upload
+ *
+ * Três passos, aplicados sobre uma IndexedMesh (ver Mesh.h):
+ *  1. Cache de vértices: ordem dos triângulos pelo algoritmo Tipsify
+ *     (Sander, Nehab e Barczak, "Fast Triangle Reordering for Vertex Locality
+ *     and Reduced Overdraw", 2007), que também devolve os pontos onde o cache
+ *     "esvazia" (fronteiras de cluster).
+ *  2. Overdraw: os clusters são ordenados de fora para dentro da malha, para que
+ *     as faces que tendem a ocultar as outras sejam desenhadas primeiro e o teste
+ *     de profundidade descarte mais fragmentos.
+ *  3. Busca de vértices: os vértices são renumerados na ordem em que aparecem nos
+ *     índices, deixando as leituras do VBO praticamente sequenciais.
+ *
+ * As métricas ACMR (cache misses por triângulo) e ATVR (cache misses por vértice,
+ * ótimo = 1.0) são calculadas simulando um cache FIFO.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <Mesh.h>
+
+// Tamanho do cache pós-transformação simulado (valor típico das GPUs atuais)
+const unsigned VERTEX_CACHE_SIZE = 16;
+
+struct VertexCacheStats
+{
+	unsigned misses = 0;
+	float acmr = 0.0f; // misses / triângulos
+	float atvr = 0.0f; // misses / vértices
+};
+
+// Simula um cache FIFO de cacheSize entradas sobre a lista de índices
+inline VertexCacheStats analyzeVertexCache(const std::vector<GLuint> &indices, size_t vertexCount, unsigned cacheSize = VERTEX_CACHE_SIZE)
+{
+	VertexCacheStats stats;
+	std::vector<unsigned> timestamps(vertexCount, 0);
+	unsigned time = cacheSize + 1;
+
+	for (GLuint index : indices)
+	{
+		if (time - timestamps[index] > cacheSize)
+		{
+			timestamps[index] = time++;
+			stats.misses++;
+		}
+	}
+
+	size_t triangleCount = indices.size() / 3;
+	stats.acmr = triangleCount ? (float)stats.misses / triangleCount : 0.0f;
+	stats.atvr = vertexCount ? (float)stats.misses / vertexCount : 0.0f;
+	return stats;
+}
+
+// Lista de adjacência vértice -> triângulos em formato compacto (offsets + dados)
+struct TriangleAdjacency
+{
+	std::vector<unsigned> offsets; // vertexCount + 1
+	std::vector<unsigned> triangles;
+};
+
+inline TriangleAdjacency buildAdjacency(const std::vector<GLuint> &indices, size_t vertexCount)
+{
+	TriangleAdjacency adj;
+	adj.offsets.assign(vertexCount + 1, 0);
+	for (GLuint index : indices)
+		adj.offsets[index + 1]++;
+	for (size_t v = 0; v < vertexCount; v++)
+		adj.offsets[v + 1] += adj.offsets[v];
+
+	adj.triangles.resize(indices.size());
+	std::vector<unsigned> fill(adj.offsets.begin(), adj.offsets.end() - 1);
+	for (size_t i = 0; i < indices.size(); i++)
+		adj.triangles[fill[indices[i]]++] = (unsigned)(i / 3);
+	return adj;
+}
+
+// Tipsify: devolve os índices reordenados. Em clusters são gravados os
+// triângulos (na nova ordem) onde começa cada cluster - sempre que o algoritmo
+// precisa "pular" para um vértice fora do cache.
+inline std::vector<GLuint> optimizeVertexCacheTipsify(const std::vector<GLuint> &indices, size_t vertexCount,
+																											unsigned cacheSize, std::vector<unsigned> *clusters = nullptr)
+{
+	const size_t triangleCount = indices.size() / 3;
+	std::vector<GLuint> result;
+	result.reserve(indices.size());
+	if (clusters)
+		clusters->clear();
+	if (triangleCount == 0)
+		return result;
+
+	TriangleAdjacency adj = buildAdjacency(indices, vertexCount);
+
+	std::vector<unsigned> liveTriangles(vertexCount);
+	for (size_t v = 0; v < vertexCount; v++)
+		liveTriangles[v] = adj.offsets[v + 1] - adj.offsets[v];
+
+	std::vector<unsigned> cacheTime(vertexCount, 0);
+	std::vector<bool> emitted(triangleCount, false);
+	std::vector<GLuint> deadEnd; // pilha de vértices recentemente usados
+	std::vector<GLuint> candidates;
+
+	unsigned time = cacheSize + 1;
+	size_t cursor = 0; // próximo vértice na ordem de entrada (para os "pulos")
+
+	auto skipDeadEnd = [&]() -> long
+	{
+		while (!deadEnd.empty())
+		{
+			GLuint v = deadEnd.back();
+			deadEnd.pop_back();
+			if (liveTriangles[v] > 0)
+				return v;
+		}
+		while (cursor < vertexCount)
+		{
+			if (liveTriangles[cursor] > 0)
+				return (long)cursor;
+			cursor++;
+		}
+		return -1;
+	};
+
+	long fanning = 0;
+	while (fanning >= 0 && liveTriangles[fanning] == 0 && (size_t)fanning + 1 < vertexCount)
+		fanning++;
+	if (clusters)
+		clusters->push_back(0);
+
+	while (fanning >= 0)
+	{
+		candidates.clear();
+
+		// Emite todos os triângulos ainda vivos ao redor do vértice atual
+		for (unsigned a = adj.offsets[fanning]; a < adj.offsets[fanning + 1]; a++)
+		{
+			unsigned t = adj.triangles[a];
+			if (emitted[t])
+				continue;
+
+			for (int k = 0; k < 3; k++)
+			{
+				GLuint v = indices[t * 3 + k];
+				result.push_back(v);
+				deadEnd.push_back(v);
+				candidates.push_back(v);
+				liveTriangles[v]--;
+				if (time - cacheTime[v] > cacheSize)
+					cacheTime[v] = time++;
+			}
+			emitted[t] = true;
+		}
+
+		// Próximo vértice: o candidato ainda no cache que mais vai ficar lá
+		long next = -1;
+		unsigned best = 0;
+		for (GLuint v : candidates)
+		{
+			if (liveTriangles[v] == 0)
+				continue;
+			unsigned priority = 0;
+			if (time - cacheTime[v] + 2 * liveTriangles[v] <= cacheSize)
+				priority = time - cacheTime[v];
+			if (priority > best || next < 0)
+			{
+				best = priority;
+				next = v;
+			}
+		}
+
+		if (next < 0)
+		{
+			next = skipDeadEnd();
+			if (next >= 0 && clusters && result.size() / 3 < triangleCount)
+				clusters->push_back((unsigned)(result.size() / 3));
+		}
+		fanning = next;
+	}
+
+	return result;
+}
+
+// Divide cada cluster em clusters menores enquanto o ACMR local continuar
+// próximo do ACMR do cluster inteiro (threshold = 1.05 -> até 5% pior).
+// Clusters menores dão mais liberdade para a ordenação contra overdraw.
+inline std::vector<unsigned> splitClusters(const std::vector<GLuint> &indices, size_t vertexCount,
+																					 const std::vector<unsigned> &hardClusters, unsigned cacheSize, float threshold)
+{
+	const unsigned triangleCount = (unsigned)(indices.size() / 3);
+	std::vector<unsigned> result;
+	std::vector<unsigned> timestamps(vertexCount, 0);
+	unsigned time = cacheSize + 1;
+
+	auto simulate = [&](unsigned begin, unsigned end)
+	{
+		time += cacheSize + 1; // esvazia o cache simulado
+		unsigned misses = 0;
+		for (unsigned i = begin * 3; i < end * 3; i++)
+		{
+			if (time - timestamps[indices[i]] > cacheSize)
+			{
+				timestamps[indices[i]] = time++;
+				misses++;
+			}
+		}
+		return misses;
+	};
+
+	for (size_t c = 0; c < hardClusters.size(); c++)
+	{
+		unsigned begin = hardClusters[c];
+		unsigned end = c + 1 < hardClusters.size() ? hardClusters[c + 1] : triangleCount;
+		float clusterAcmr = (float)simulate(begin, end) / (end - begin);
+
+		result.push_back(begin);
+		time += cacheSize + 1;
+		unsigned misses = 0, start = begin;
+		for (unsigned t = begin; t < end; t++)
+		{
+			for (int k = 0; k < 3; k++)
+			{
+				GLuint v = indices[t * 3 + k];
+				if (time - timestamps[v] > cacheSize)
+				{
+					timestamps[v] = time++;
+					misses++;
+				}
+			}
+			unsigned count = t + 1 - start;
+			if (t + 1 < end && count >= 8 && (float)misses / count <= clusterAcmr * threshold)
+			{
+				result.push_back(t + 1);
+				start = t + 1;
+				misses = 0;
+				time += cacheSize + 1;
+			}
+		}
+	}
+	return result;
+}
+
+// Ordena os clusters de triângulos de forma que os que apontam para fora da
+// malha (e portanto tendem a ocultar os demais) sejam desenhados primeiro
+inline std::vector<GLuint> optimizeOverdraw(const std::vector<GLuint> &indices, const std::vector<Vertex> &vertices,
+																						const std::vector<unsigned> &clusters)
+{
+	const unsigned triangleCount = (unsigned)(indices.size() / 3);
+	if (clusters.size() <= 1)
+		return indices;
+
+	glm::vec3 meshCentroid(0.0f);
+	float meshArea = 0.0f;
+
+	struct ClusterInfo
+	{
+		unsigned begin, end;
+		glm::vec3 centroid;
+		glm::vec3 normal;
+		float area;
+		float sortKey;
+	};
+	std::vector<ClusterInfo> infos(clusters.size());
+
+	for (size_t c = 0; c < clusters.size(); c++)
+	{
+		ClusterInfo &info = infos[c];
+		info.begin = clusters[c];
+		info.end = c + 1 < clusters.size() ? clusters[c + 1] : triangleCount;
+		info.centroid = glm::vec3(0.0f);
+		info.normal = glm::vec3(0.0f);
+		info.area = 0.0f;
+
+		for (unsigned t = info.begin; t < info.end; t++)
+		{
+			const glm::vec3 &p0 = vertices[indices[t * 3 + 0]].position;
+			const glm::vec3 &p1 = vertices[indices[t * 3 + 1]].position;
+			const glm::vec3 &p2 = vertices[indices[t * 3 + 2]].position;
+			glm::vec3 n = glm::cross(p1 - p0, p2 - p0); // |n| = 2 * área
+			float area = glm::length(n) * 0.5f;
+
+			info.normal += n;
+			info.centroid += (p0 + p1 + p2) * (area / 3.0f);
+			info.area += area;
+		}
+
+		meshCentroid += info.centroid;
+		meshArea += info.area;
+		if (info.area > 0.0f)
+			info.centroid /= info.area;
+	}
+	if (meshArea > 0.0f)
+		meshCentroid /= meshArea;
+
+	for (ClusterInfo &info : infos)
+	{
+		float len = glm::length(info.normal);
+		info.sortKey = len > 0.0f ? glm::dot(info.centroid - meshCentroid, info.normal / len) : 0.0f;
+	}
+
+	std::stable_sort(infos.begin(), infos.end(), [](const ClusterInfo &a, const ClusterInfo &b)
+									 { return a.sortKey > b.sortKey; });
+
+	std::vector<GLuint> result;
+	result.reserve(indices.size());
+	for (const ClusterInfo &info : infos)
+		result.insert(result.end(), indices.begin() + info.begin * 3, indices.begin() + info.end * 3);
+	return result;
+}
+
+// Renumera os vértices pela ordem de primeiro uso nos índices. Vértices que
+// nenhum triângulo usa são descartados.
+inline void optimizeVertexFetch(IndexedMesh &mesh)
+{
+	const GLuint unused = ~0u;
+	std::vector<GLuint> remap(mesh.vertices.size(), unused);
+	std::vector<Vertex> vertices;
+	vertices.reserve(mesh.vertices.size());
+
+	for (GLuint &index : mesh.indices)
+	{
+		if (remap[index] == unused)
+		{
+			remap[index] = (GLuint)vertices.size();
+			vertices.push_back(mesh.vertices[index]);
+		}
+		index = remap[index];
+	}
+	mesh.vertices.swap(vertices);
+}
+
+// Executa os três passos e imprime as métricas antes/depois
+inline void optimizeMesh(IndexedMesh &mesh, const char *name, float overdrawThreshold = 1.05f)
+{
+	if (mesh.indices.size() < 3)
+		return;
+
+	VertexCacheStats before = analyzeVertexCache(mesh.indices, mesh.vertices.size());
+
+	std::vector<unsigned> clusters;
+	mesh.indices = optimizeVertexCacheTipsify(mesh.indices, mesh.vertices.size(), VERTEX_CACHE_SIZE, &clusters);
+	clusters = splitClusters(mesh.indices, mesh.vertices.size(), clusters, VERTEX_CACHE_SIZE, overdrawThreshold);
+	mesh.indices = optimizeOverdraw(mesh.indices, mesh.vertices, clusters);
+	optimizeVertexFetch(mesh);
+
+	VertexCacheStats after = analyzeVertexCache(mesh.indices, mesh.vertices.size());
+
+	std::cout << "Otimizacao (" << name << "): " << mesh.indices.size() / 3 << " triangulos, "
+						<< clusters.size() << " clusters, ACMR " << before.acmr << " -> " << after.acmr
+						<< ", ATVR " << before.atvr << " -> " << after.atvr << std::endl;
+}
@@ -0,0 +1,46 @@
+/* Parallel.h - execução paralela simples sobre o JobSystem
+ *
+ * runParallel(count, fn) chama fn(i) para i em [0, count), uma tarefa por
+ * item no agendador do programa (JobSystem.h); o item 0 roda na thread que
+ * chamou, que depois ajuda com os outros até todos terminarem. Usado para
+ * dividir trabalho grande e independente (blocos de um arquivo, faixas de
+ * objetos) entre os núcleos sem criar threads a cada chamada.
+ * runParallelRanges divide [0, count) em faixas contíguas, uma por thread.
+ */
+
+#pragma once
+
+#include <algorithm>
+
+#include <JobSystem.h>
+
+template <typename Function>
+void runParallel(size_t count, Function fn)
+{
+	JobSystem &jobs = jobSystem();
+	JobCounter counter;
+	for (size_t i = 1; i < count; i++)
+		jobs.run(counter, [&fn, i]()
+						 { fn(i); });
+	if (count > 0)
+		fn((size_t)0);
+	jobs.wait(counter);
+}
+
+// fn(faixa, primeiro, último) para faixas contíguas de [0, count), no máximo
+// uma por núcleo e com pelo menos minPerThread itens cada (ou uma só). A faixa
+// i vem sempre antes da i + 1. Devolve o número de faixas.
+template <typename Function>
+size_t runParallelRanges(size_t count, size_t minPerThread, Function fn, size_t maxThreads = 0)
+{
+	size_t chunks = maxThreads ? maxThreads : workerThreadCount();
+	chunks = std::max<size_t>(1, std::min(chunks, count / std::max<size_t>(minPerThread, 1)));
+	const size_t perChunk = (count + chunks - 1) / chunks;
+	runParallel(chunks, [&](size_t chunk)
+							{
+		const size_t first = std::min(count, chunk * perChunk);
+		const size_t last = std::min(count, first + perChunk);
+		if (first < last)
+			fn(chunk, first, last); });
+	return chunks;
+}
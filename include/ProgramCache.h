@@ -0,0 +1,321 @@
+/* ProgramCache.h - compilação de programas de shader com cache do binário em disco
+ *
+ * buildProgram() compila e linka os estágios de um programa. Depois do link, o
+ * binário gerado pelo driver (glGetProgramBinary) é gravado em
+ * .programcache/<nome>.progcache; na próxima execução ele volta com
+ * glProgramBinary, sem passar pelo compilador de GLSL.
+ *
+ * A chave do cache é um hash do texto de cada estágio, dos #defines injetados
+ * e das strings do driver (GL_VENDOR, GL_RENDERER, GL_VERSION): mudar o shader
+ * ou atualizar o driver gera uma chave nova e o programa é recompilado. O
+ * driver também pode recusar um binário antigo (glProgramBinary falha no
+ * GL_LINK_STATUS); nesse caso o programa é recompilado e o cache regravado.
+ *
+ * Layout do arquivo: ProgramCacheHeader | binário do driver
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include <Hash.h>
+#include <MappedFile.h>
+
+// Incrementar sempre que mudar o layout do arquivo
+const uint32_t PROGRAM_CACHE_VERSION = 1;
+const char PROGRAM_CACHE_MAGIC[8] = {'H', '3', 'D', 'P', 'R', 'O', 'G', '\0'};
+
+struct ProgramCacheHeader
+{
+	char magic[8];
+	uint32_t version;
+	uint32_t headerSize;
+	uint64_t key;					// hash dos fontes, defines e driver
+	uint32_t binaryFormat; // formato devolvido por glGetProgramBinary
+	uint32_t binaryBytes;
+	uint64_t binaryHash;
+};
+
+struct ShaderStage
+{
+	GLenum type;
+	const GLchar *source;
+};
+
+struct ProgramCacheSettings
+{
+	bool enabled = true;
+	std::string directory = ".programcache";
+};
+
+inline ProgramCacheSettings &programCacheSettings()
+{
+	static ProgramCacheSettings settings;
+	return settings;
+}
+
+inline const char *shaderStageName(GLenum type)
+{
+	switch (type)
+	{
+	case GL_VERTEX_SHADER:
+		return "VERTEX";
+	case GL_FRAGMENT_SHADER:
+		return "FRAGMENT";
+	case GL_GEOMETRY_SHADER:
+		return "GEOMETRY";
+	case GL_COMPUTE_SHADER:
+		return "COMPUTE";
+	default:
+		return "UNKNOWN";
+	}
+}
+
+// Os defines entram logo depois da linha do #version (que precisa ser a primeira)
+inline void splitVersionLine(const std::string &source, std::string &version, std::string &body)
+{
+	size_t end = source.rfind("#version", 0) == 0 ? source.find('\n') : std::string::npos;
+	if (end == std::string::npos)
+	{
+		version.clear();
+		body = source;
+		return;
+	}
+	version = source.substr(0, end + 1);
+	body = source.substr(end + 1);
+}
+
+inline uint64_t programCacheKey(const std::vector<ShaderStage> &stages, const std::string &defines)
+{
+	std::string text;
+	for (GLenum name : {GL_VENDOR, GL_RENDERER, GL_VERSION})
+	{
+		const GLubyte *value = glGetString(name);
+		text += value ? (const char *)value : "";
+		text += '\0';
+	}
+	text += defines;
+	text += '\0';
+	for (const ShaderStage &stage : stages)
+	{
+		text += shaderStageName(stage.type);
+		text += '\0';
+		text += stage.source;
+		text += '\0';
+	}
+	return hashBytes((const uint8_t *)text.data(), text.size());
+}
+
+inline std::string programCachePath(const std::string &name)
+{
+	return programCacheSettings().directory + "/" + name + ".progcache";
+}
+
+// O driver precisa oferecer pelo menos um formato de binário
+inline bool programBinarySupported()
+{
+	GLint formats = 0;
+	glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+	return formats > 0;
+}
+
+// Tenta carregar o programa do cache; devolve 0 se não houver cache válido
+inline GLuint loadCachedProgram(const std::string &name, uint64_t key)
+{
+	MappedFile file;
+	if (!file.open(programCachePath(name)) || file.size() < sizeof(ProgramCacheHeader))
+		return 0;
+
+	ProgramCacheHeader h;
+	memcpy(&h, file.data(), sizeof(h));
+	const char *reason = nullptr;
+	if (memcmp(h.magic, PROGRAM_CACHE_MAGIC, sizeof(h.magic)) != 0 || h.version != PROGRAM_CACHE_VERSION ||
+			h.headerSize != sizeof(ProgramCacheHeader))
+		reason = "versao diferente";
+	else if (h.key != key)
+		reason = "shader ou driver diferente";
+	else if (sizeof(h) + (uint64_t)h.binaryBytes > file.size())
+		reason = "arquivo truncado";
+	else if (hashBytes(file.data() + sizeof(h), h.binaryBytes) != h.binaryHash)
+		reason = "arquivo corrompido";
+	if (reason)
+	{
+		std::cout << "Cache do programa " << name << " invalido (" << reason << "), recompilando" << std::endl;
+		return 0;
+	}
+
+	GLuint program = glCreateProgram();
+	glProgramBinary(program, (GLenum)h.binaryFormat, file.data() + sizeof(h), (GLsizei)h.binaryBytes);
+	GLint success = GL_FALSE;
+	glGetProgramiv(program, GL_LINK_STATUS, &success);
+	if (!success)
+	{
+		std::cout << "Cache do programa " << name << " recusado pelo driver, recompilando" << std::endl;
+		glDeleteProgram(program);
+		return 0;
+	}
+	return program;
+}
+
+// Grava o binário do programa linkado. Como no cache de malhas, o arquivo é
+// escrito com outro nome e renomeado no final.
+inline bool writeProgramCache(const std::string &name, uint64_t key, GLuint program)
+{
+	GLint length = 0;
+	glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+	if (length <= 0)
+		return false;
+	std::vector<uint8_t> binary((size_t)length);
+	GLenum format = 0;
+	glGetProgramBinary(program, length, &length, &format, binary.data());
+	binary.resize((size_t)length);
+
+	ProgramCacheHeader h;
+	memset(&h, 0, sizeof(h));
+	memcpy(h.magic, PROGRAM_CACHE_MAGIC, sizeof(h.magic));
+	h.version = PROGRAM_CACHE_VERSION;
+	h.headerSize = sizeof(ProgramCacheHeader);
+	h.key = key;
+	h.binaryFormat = (uint32_t)format;
+	h.binaryBytes = (uint32_t)binary.size();
+	h.binaryHash = hashBytes(binary.data(), binary.size());
+
+	const std::string path = programCachePath(name);
+	const std::string temporary = path + ".tmp";
+	std::error_code ec;
+	std::filesystem::create_directories(programCacheSettings().directory, ec);
+	FILE *f = fopen(temporary.c_str(), "wb");
+	if (!f)
+	{
+		std::cout << "ERROR::PROGRAM_CACHE::WRITE_FAILED " << path << std::endl;
+		return false;
+	}
+	bool ok = fwrite(&h, sizeof(h), 1, f) == 1;
+	ok = ok && fwrite(binary.data(), 1, binary.size(), f) == binary.size();
+	ok = fclose(f) == 0 && ok;
+
+	if (ok)
+		std::filesystem::rename(temporary, path, ec);
+	if (!ok || ec)
+	{
+		std::filesystem::remove(temporary, ec);
+		std::cout << "ERROR::PROGRAM_CACHE::WRITE_FAILED " << path << std::endl;
+		return false;
+	}
+	return true;
+}
+
+// Programa cuja compilação e link já foram pedidos ao driver, sem consultar o resultado
+struct PendingProgram
+{
+	GLuint program = 0;
+	std::vector<GLuint> shaders;
+	std::vector<GLenum> types;
+};
+
+// Envia os estágios (com os defines depois do #version) e pede o link. Não
+// consulta nenhum status, para o driver poder compilar em segundo plano.
+inline PendingProgram startCompile(const std::vector<ShaderStage> &stages, const std::string &defines, bool retrievable)
+{
+	PendingProgram pending;
+	pending.program = glCreateProgram();
+	for (const ShaderStage &stage : stages)
+	{
+		std::string version, body;
+		splitVersionLine(stage.source, version, body);
+		const GLchar *parts[3] = {version.c_str(), defines.c_str(), body.c_str()};
+
+		GLuint shader = glCreateShader(stage.type);
+		glShaderSource(shader, 3, parts, NULL);
+		glCompileShader(shader);
+		glAttachShader(pending.program, shader);
+		pending.shaders.push_back(shader);
+		pending.types.push_back(stage.type);
+	}
+	if (retrievable)
+		glProgramParameteri(pending.program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	glLinkProgram(pending.program);
+	return pending;
+}
+
+// Confere compilação e link (espera o driver, se ele ainda não terminou) e
+// libera os shaders. Devolve o programa ou 0 se falhar.
+inline GLuint finishCompile(PendingProgram &pending)
+{
+	GLint success;
+	GLchar infoLog[512];
+	bool compiled = true;
+	for (size_t i = 0; i < pending.shaders.size(); i++)
+	{
+		glGetShaderiv(pending.shaders[i], GL_COMPILE_STATUS, &success);
+		if (!success)
+		{
+			glGetShaderInfoLog(pending.shaders[i], 512, NULL, infoLog);
+			std::cout << "ERROR::SHADER::" << shaderStageName(pending.types[i]) << "::COMPILATION_FAILED\n"
+								<< infoLog << std::endl;
+			compiled = false;
+		}
+	}
+	if (compiled)
+	{
+		glGetProgramiv(pending.program, GL_LINK_STATUS, &success);
+		if (!success)
+		{
+			glGetProgramInfoLog(pending.program, 512, NULL, infoLog);
+			std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n"
+								<< infoLog << std::endl;
+			compiled = false;
+		}
+	}
+	for (GLuint shader : pending.shaders)
+		glDeleteShader(shader);
+	pending.shaders.clear();
+
+	GLuint program = pending.program;
+	pending.program = 0;
+	if (!compiled)
+	{
+		glDeleteProgram(program);
+		return 0;
+	}
+	return program;
+}
+
+inline GLuint compileProgram(const std::vector<ShaderStage> &stages, const std::string &defines, bool retrievable)
+{
+	PendingProgram pending = startCompile(stages, defines, retrievable);
+	return finishCompile(pending);
+}
+
+// Programa pronto para uso: do cache se possível, senão compilado (e gravado no cache)
+inline GLuint buildProgram(const std::string &name, const std::vector<ShaderStage> &stages, const std::string &defines = "")
+{
+	auto start = std::chrono::steady_clock::now();
+	const bool cached = programCacheSettings().enabled && programBinarySupported();
+	const uint64_t key = cached ? programCacheKey(stages, defines) : 0;
+
+	GLuint program = cached ? loadCachedProgram(name, key) : 0;
+	const bool fromCache = program != 0;
+	if (!program)
+	{
+		program = compileProgram(stages, defines, cached);
+		if (program && cached)
+			writeProgramCache(name, key, program);
+	}
+
+	if (program)
+	{
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		std::cout << "Programa " << name << (fromCache ? ": cache" : ": compilado") << " em " << seconds * 1000.0 << " ms" << std::endl;
+	}
+	return program;
+}
@@ -0,0 +1,313 @@
+/* RenderQueue.h - fila de desenho ordenada por chave de 64 bits
+ *
+ * Em vez de desenhar direto, o loop coloca cada draw na fila: um
+ * RenderCommand (programa, VAO, material, tipo de draw, matriz do objeto) e
+ * uma chave de ordenação montada a partir dele:
+ *
+ *   bits 63-60 passo | 59-48 programa | 47-36 material | 35-24 VAO | 23-0 profundidade
+ *
+ * No submit() a fila é ordenada por radix sort (LSD, 8 bits por vez, estável)
+ * e os comandos são enviados na ordem da chave: todos os draws de um passo,
+ * dentro dele agrupados por programa, depois material e VAO, e de frente para
+ * trás. As trocas de estado passam pelo RenderState, então cada grupo custa
+ * um glUseProgram/glBindVertexArray só.
+ *
+ * Montar a fila também pode ser dividido entre threads: pushParallel reserva
+ * os comandos e cada thread preenche uma faixa deles. No submit, a ordem
+ * ordenada de cada passo é gravada em paralelo em listas de comandos (uma por
+ * thread, CommandList.h) e só a execução das listas fica no thread principal.
+ * A ordem final não depende do número de threads: radix sort estável e listas
+ * executadas na ordem das faixas.
+ *
+ * O submit mede cada passo (draws, chamadas de estado, tempo de gravação e de
+ * envio), o único lugar onde o custo de envio é contado. Com um GpuProfiler
+ * (setProfiler), cada passo também vira um trecho de tempo de GPU.
+ *
+ * Limitação: programa, material e VAO entram na chave com 12 bits (os nomes
+ * da OpenGL são pequenos); nomes maiores só pioram o agrupamento, o estado
+ * enviado vem sempre do comando.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <CommandList.h>
+#include <CpuProfiler.h>
+#include <GpuProfiler.h>
+#include <Parallel.h>
+#include <RenderState.h>
+
+enum RenderPass
+{
+	PASS_OPAQUE,
+	PASS_POINTS, // vértices da pirâmide, por cima dos triângulos
+	PASS_COUNT
+};
+
+inline const char *renderPassName(RenderPass pass)
+{
+	switch (pass)
+	{
+	case PASS_OPAQUE:
+		return "opaco";
+	case PASS_POINTS:
+		return "pontos";
+	default:
+		return "?";
+	}
+}
+
+enum RenderCommandType
+{
+	DRAW_ELEMENTS,
+	DRAW_ELEMENTS_INSTANCED,
+	DRAW_ARRAYS,
+	DRAW_CALLBACK // o desenho é feito por uma função (multi-draw do lote, ...)
+};
+
+struct RenderCommand
+{
+	RenderPass pass = PASS_OPAQUE;
+	GLuint program = 0;
+	GLuint vertexArray = 0;
+	uint32_t material = 0;
+	float depth = 0.0f; // 0 = mais perto, 1 = mais longe
+
+	RenderCommandType type = DRAW_ELEMENTS;
+	GLenum mode = GL_TRIANGLES;
+	GLsizei count = 0;
+	GLenum indexType = GL_UNSIGNED_INT;
+	GLsizei instances = 1;
+	uint32_t drawCalls = 1; // chamadas de desenho feitas (DRAW_CALLBACK pode fazer várias)
+
+	// Matriz do objeto, enviada se location >= 0 (filtrada pelo RenderState se repetir)
+	GLint modelLocation = -1;
+	glm::mat4 model = glm::mat4(1);
+
+	std::function<void()> draw; // DRAW_CALLBACK
+};
+
+struct RenderPassStats
+{
+	uint64_t draws = 0;
+	uint64_t stateCalls = 0; // chamadas de estado que foram para a OpenGL
+	double recordSeconds = 0.0; // gravação das listas (em paralelo)
+	double seconds = 0.0;				// execução das listas no contexto
+};
+
+inline uint64_t renderSortKey(const RenderCommand &command)
+{
+	const uint64_t depth = (uint64_t)(std::min(std::max(command.depth, 0.0f), 1.0f) * 0xFFFFFF);
+	return ((uint64_t)command.pass << 60) | ((uint64_t)(command.program & 0xFFF) << 48) | ((uint64_t)(command.material & 0xFFF) << 36) |
+				 ((uint64_t)(command.vertexArray & 0xFFF) << 24) | depth;
+}
+
+struct RenderItem
+{
+	uint64_t key;
+	uint32_t command; // índice em RenderQueue::commands
+};
+
+// Radix sort LSD de 8 bits; pula os dígitos iguais em todas as chaves (quase
+// sempre os do passo e do programa). Estável: empates ficam na ordem de entrada.
+inline void radixSortRenderItems(std::vector<RenderItem> &items, std::vector<RenderItem> &scratch)
+{
+	const size_t n = items.size();
+	if (n < 2)
+		return;
+	scratch.resize(n);
+	RenderItem *source = items.data(), *destination = scratch.data();
+	for (int shift = 0; shift < 64; shift += 8)
+	{
+		size_t counts[256] = {};
+		for (size_t i = 0; i < n; i++)
+			counts[(source[i].key >> shift) & 0xFF]++;
+		if (counts[(source[0].key >> shift) & 0xFF] == n)
+			continue;
+		size_t offset = 0;
+		for (size_t &count : counts)
+		{
+			size_t c = count;
+			count = offset;
+			offset += c;
+		}
+		for (size_t i = 0; i < n; i++)
+			destination[counts[(source[i].key >> shift) & 0xFF]++] = source[i];
+		std::swap(source, destination);
+	}
+	if (source != items.data())
+		memcpy(items.data(), source, n * sizeof(RenderItem));
+}
+
+class RenderQueue
+{
+public:
+	// Começo do frame: esvazia a fila (a memória fica para o próximo)
+	void clear()
+	{
+		commands.clear();
+		items.clear();
+	}
+
+	// Novo comando na fila; o chamador preenche o que faltar
+	RenderCommand &push(RenderPass pass, GLuint program, GLuint vertexArray, uint32_t material = 0, float depth = 0.0f)
+	{
+		commands.emplace_back();
+		RenderCommand &command = commands.back();
+		command.pass = pass;
+		command.program = program;
+		command.vertexArray = vertexArray;
+		command.material = material;
+		command.depth = depth;
+		return command;
+	}
+
+	// count comandos de uma vez, preenchidos em paralelo: fill(i, comando) roda
+	// em vários threads, cada um numa faixa de i. O comando chega com passo,
+	// programa e VAO; fill não pode chamar a OpenGL nem mexer na fila.
+	template <typename Function>
+	void pushParallel(size_t count, RenderPass pass, GLuint program, GLuint vertexArray, Function fill)
+	{
+		const size_t base = commands.size();
+		commands.resize(base + count);
+		runParallelRanges(count, COMMANDS_MIN_PER_THREAD, [&](size_t, size_t first, size_t last)
+											{
+			for (size_t i = first; i < last; i++)
+			{
+				RenderCommand &command = commands[base + i];
+				command.pass = pass;
+				command.program = program;
+				command.vertexArray = vertexArray;
+				fill(i, command);
+			} });
+	}
+
+	// Ordena e desenha tudo. bindMaterial troca o estado de um material.
+	void submit(const std::function<void(uint32_t material)> &bindMaterial = nullptr)
+	{
+		ProfileZone zone("envio da fila");
+		items.resize(commands.size());
+		runParallelRanges(commands.size(), COMMANDS_MIN_PER_THREAD, [&](size_t, size_t first, size_t last)
+											{
+			for (size_t i = first; i < last; i++)
+				items[i] = {renderSortKey(commands[i]), (uint32_t)i}; });
+		radixSortRenderItems(items, scratch);
+		frameDrawCalls = 0;
+		for (const RenderCommand &command : commands)
+			frameDrawCalls += command.drawCalls;
+
+		RenderState &state = renderState();
+		size_t i = 0;
+		while (i < items.size())
+		{
+			// Um passo por vez, para medir cada um
+			const RenderPass pass = commands[items[i].command].pass;
+			size_t end = i;
+			while (end < items.size() && commands[items[end].command].pass == pass)
+				end++;
+			RenderPassStats &stats = passStats[pass];
+
+			auto start = std::chrono::steady_clock::now();
+			recordParallel(lists, end - i, [&](CommandList &list, size_t first, size_t last)
+										 {
+				ProfileZone recordZone("gravar comandos");
+				record(list, i + first, i + last); });
+			auto recorded = std::chrono::steady_clock::now();
+			const uint32_t callsBefore = state.counters().issued;
+			if (profiler)
+				profiler->begin(renderPassName(pass));
+			{
+				ProfileZone replayZone(renderPassName(pass));
+				replayAll(lists, state, bindMaterial);
+			}
+			if (profiler)
+				profiler->end();
+
+			stats.draws += end - i;
+			stats.recordSeconds += std::chrono::duration<double>(recorded - start).count();
+			stats.seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - recorded).count();
+			stats.stateCalls += state.counters().issued - callsBefore;
+			i = end;
+		}
+		frames++;
+	}
+
+	// Médias por frame desde o último resetStats()
+	RenderPassStats averagePass(RenderPass pass) const
+	{
+		RenderPassStats average = passStats[pass];
+		if (frames > 0)
+		{
+			average.draws /= frames;
+			average.stateCalls /= frames;
+			average.seconds /= frames;
+			average.recordSeconds /= frames;
+		}
+		return average;
+	}
+
+	void resetStats()
+	{
+		for (RenderPassStats &stats : passStats)
+			stats = RenderPassStats();
+		frames = 0;
+	}
+
+	// Tempo de GPU de cada passo (nullptr: sem medir)
+	void setProfiler(GpuProfiler *gpuProfiler) { profiler = gpuProfiler; }
+
+	size_t size() const { return commands.size(); }
+	// Chamadas de desenho do último submit
+	uint32_t drawCalls() const { return frameDrawCalls; }
+
+private:
+	// Grava os itens [first, last) da ordem já ordenada; só o que muda de um
+	// comando para o seguinte vira troca de estado na lista
+	void record(CommandList &list, size_t first, size_t last) const
+	{
+		uint32_t program = ~0u, vertexArray = ~0u, material = ~0u;
+		for (size_t i = first; i < last; i++)
+		{
+			const RenderCommand &command = commands[items[i].command];
+			if (command.program != program)
+				list.useProgram(program = command.program);
+			if (command.vertexArray != vertexArray)
+				list.bindVertexArray(vertexArray = command.vertexArray);
+			if (command.material != material)
+				list.bindMaterial(material = command.material);
+			list.uniform(command.modelLocation, command.model);
+			switch (command.type)
+			{
+			case DRAW_ELEMENTS:
+				list.drawElements(command.mode, command.count, command.indexType);
+				break;
+			case DRAW_ELEMENTS_INSTANCED:
+				list.drawElements(command.mode, command.count, command.indexType, command.instances);
+				break;
+			case DRAW_ARRAYS:
+				list.drawArrays(command.mode, 0, command.count);
+				break;
+			case DRAW_CALLBACK:
+				list.callback(&command.draw);
+				break;
+			}
+		}
+	}
+
+	std::vector<RenderCommand> commands;
+	std::vector<RenderItem> items, scratch;
+	std::vector<CommandList> lists; // uma por thread, reaproveitadas a cada frame
+	RenderPassStats passStats[PASS_COUNT];
+	uint32_t frameDrawCalls = 0;
+	uint64_t frames = 0;
+	GpuProfiler *profiler = nullptr;
+};
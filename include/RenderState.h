@@ -0,0 +1,330 @@
+/* RenderState.h - cache do estado OpenGL, para não repetir chamadas
+ *
+ * O driver não tem como saber que um glUseProgram, glBindBufferBase ou
+ * glUniform* repete o que já está no contexto, e cada chamada custa validação
+ * na CPU. RenderState guarda o último valor enviado de cada estado (programa,
+ * VAO, framebuffer, buffers indexados, texturas, imagens, capacidades do
+ * glEnable, profundidade, blend, raster, viewport e valores de uniforms por
+ * programa) e só chama a OpenGL quando o valor muda.
+ *
+ * Todo o código que desenha no contexto principal deve passar por
+ * renderState(); quem mudar estado por fora chama invalidate(). Os contadores
+ * (chamadas feitas / filtradas) são por frame: endFrame() fecha o frame.
+ *
+ * Limitação: um objeto apagado enquanto ligado pode ter o nome reaproveitado
+ * pela OpenGL; para programas, forgetProgram() descarta os uniforms guardados.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+struct RenderStateStats
+{
+	uint32_t issued = 0;	 // chamadas que foram para a OpenGL
+	uint32_t filtered = 0; // chamadas puladas (estado já era esse)
+};
+
+class RenderState
+{
+public:
+	void useProgram(GLuint program)
+	{
+		if (!changed(currentProgram, program))
+			return;
+		glUseProgram(program);
+	}
+
+	void bindVertexArray(GLuint vao)
+	{
+		if (!changed(currentVertexArray, vao))
+			return;
+		glBindVertexArray(vao);
+	}
+
+	void bindFramebuffer(GLuint framebuffer)
+	{
+		if (!changed(currentFramebuffer, framebuffer))
+			return;
+		glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	}
+
+	// Pontos de ligação não indexados (GL_DRAW_INDIRECT_BUFFER, ...)
+	void bindBuffer(GLenum target, GLuint buffer)
+	{
+		if (!changed(slot(targets, target), buffer))
+			return;
+		glBindBuffer(target, buffer);
+	}
+
+	// Buffer inteiro num ponto indexado (SSBO/UBO); também muda o ponto genérico do alvo
+	void bindBufferBase(GLenum target, GLuint index, GLuint buffer)
+	{
+		slot(targets, target) = buffer;
+		if (!changed(indexed(target, index), {buffer, 0, 0}))
+			return;
+		glBindBufferBase(target, index, buffer);
+	}
+
+	void bindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size)
+	{
+		slot(targets, target) = buffer;
+		if (!changed(indexed(target, index), {buffer, offset, size}))
+			return;
+		glBindBufferRange(target, index, buffer, offset, size);
+	}
+
+	void bindTextureUnit(GLuint unit, GLuint texture)
+	{
+		if (!changed(grow(textureUnits, unit, UNKNOWN), texture))
+			return;
+		glBindTextureUnit(unit, texture);
+	}
+
+	void bindImageTexture(GLuint unit, GLuint texture, GLint level, GLboolean layered, GLint layer, GLenum access, GLenum format)
+	{
+		if (!changed(grow(imageUnits, unit), {texture, level, layered, layer, access, format}))
+			return;
+		glBindImageTexture(unit, texture, level, layered, layer, access, format);
+	}
+
+	// glEnable/glDisable (GL_DEPTH_TEST, GL_BLEND, GL_CULL_FACE, ...)
+	void enable(GLenum capability, bool enabled = true)
+	{
+		if (!changed(slot(capabilities, capability), (GLuint)enabled))
+			return;
+		if (enabled)
+			glEnable(capability);
+		else
+			glDisable(capability);
+	}
+	void disable(GLenum capability) { enable(capability, false); }
+
+	void depthFunc(GLenum func)
+	{
+		if (!changed(currentDepthFunc, func))
+			return;
+		glDepthFunc(func);
+	}
+
+	void depthMask(bool write)
+	{
+		if (!changed(currentDepthMask, (GLuint)write))
+			return;
+		glDepthMask(write ? GL_TRUE : GL_FALSE);
+	}
+
+	void blendFunc(GLenum source, GLenum destination)
+	{
+		if (!changed(currentBlend, {source, destination}))
+			return;
+		glBlendFunc(source, destination);
+	}
+
+	void cullFace(GLenum face)
+	{
+		if (!changed(currentCullFace, face))
+			return;
+		glCullFace(face);
+	}
+
+	void lineWidth(GLfloat width)
+	{
+		if (!changed(currentLineWidth, width))
+			return;
+		glLineWidth(width);
+	}
+
+	void pointSize(GLfloat size)
+	{
+		if (!changed(currentPointSize, size))
+			return;
+		glPointSize(size);
+	}
+
+	void clearColor(const glm::vec4 &color)
+	{
+		if (!changed(currentClearColor, color))
+			return;
+		glClearColor(color.r, color.g, color.b, color.a);
+	}
+
+	void viewport(GLint x, GLint y, GLsizei width, GLsizei height)
+	{
+		if (!changed(currentViewport, glm::ivec4(x, y, width, height)))
+			return;
+		glViewport(x, y, width, height);
+	}
+
+	// Uniforms do programa em uso (location -1 é ignorada, como na OpenGL)
+	void uniform(GLint location, GLint value)
+	{
+		if (cachedUniform(location, &value, sizeof(value)))
+			glUniform1i(location, value);
+	}
+	void uniform(GLint location, GLuint value)
+	{
+		if (cachedUniform(location, &value, sizeof(value)))
+			glUniform1ui(location, value);
+	}
+	void uniform(GLint location, bool value) { uniform(location, (GLint)value); }
+	void uniform(GLint location, const glm::ivec2 &value)
+	{
+		if (cachedUniform(location, &value, sizeof(value)))
+			glUniform2i(location, value.x, value.y);
+	}
+	void uniform(GLint location, const glm::mat4 &value)
+	{
+		if (cachedUniform(location, &value, sizeof(value)))
+			glUniformMatrix4fv(location, 1, GL_FALSE, &value[0][0]);
+	}
+	void uniform(GLint location, const glm::vec4 *values, GLsizei count)
+	{
+		if (cachedUniform(location, values, count * sizeof(glm::vec4)))
+			glUniform4fv(location, count, &values[0][0]);
+	}
+
+	// Descarta os uniforms guardados de um programa (apagado ou recompilado)
+	void forgetProgram(GLuint program)
+	{
+		for (auto it = uniforms.begin(); it != uniforms.end();)
+			it = (GLuint)(it->first >> 32) == program ? uniforms.erase(it) : std::next(it);
+	}
+
+	// Esquece tudo: a próxima chamada de cada estado vai para a OpenGL
+	void invalidate()
+	{
+		RenderStateStats keep = current;
+		*this = RenderState();
+		current = keep;
+	}
+
+	// Fecha os contadores do frame
+	void endFrame()
+	{
+		last = current;
+		current = RenderStateStats();
+	}
+
+	// Contadores do último frame fechado
+	const RenderStateStats &frameStats() const { return last; }
+	// Contadores do frame em andamento
+	const RenderStateStats &counters() const { return current; }
+
+private:
+	static constexpr GLuint UNKNOWN = ~0u;
+
+	struct BufferRange
+	{
+		GLuint buffer = UNKNOWN;
+		GLintptr offset = 0;
+		GLsizeiptr size = 0;
+		bool operator!=(const BufferRange &o) const { return buffer != o.buffer || offset != o.offset || size != o.size; }
+	};
+
+	struct ImageUnit
+	{
+		GLuint texture = UNKNOWN;
+		GLint level = 0;
+		GLboolean layered = GL_FALSE;
+		GLint layer = 0;
+		GLenum access = 0, format = 0;
+		bool operator!=(const ImageUnit &o) const
+		{
+			return texture != o.texture || level != o.level || layered != o.layered || layer != o.layer || access != o.access || format != o.format;
+		}
+	};
+
+	struct BlendState
+	{
+		GLenum source = UNKNOWN, destination = UNKNOWN;
+		bool operator!=(const BlendState &o) const { return source != o.source || destination != o.destination; }
+	};
+
+	// Guarda o valor novo e conta a chamada; devolve true se ela precisa ir para a OpenGL
+	template <typename T>
+	bool changed(T &state, const T &value)
+	{
+		if (!(state != value))
+		{
+			current.filtered++;
+			return false;
+		}
+		state = value;
+		current.issued++;
+		return true;
+	}
+
+	// Estado por enum (alvo de buffer, capacidade): poucos, busca linear
+	static GLuint &slot(std::vector<std::pair<GLenum, GLuint>> &list, GLenum name)
+	{
+		for (auto &entry : list)
+			if (entry.first == name)
+				return entry.second;
+		list.push_back({name, UNKNOWN});
+		return list.back().second;
+	}
+
+	template <typename T>
+	static T &grow(std::vector<T> &list, GLuint index, const T &unknown = T())
+	{
+		if (index >= list.size())
+			list.resize(index + 1, unknown);
+		return list[index];
+	}
+
+	BufferRange &indexed(GLenum target, GLuint index)
+	{
+		for (auto &entry : indexedTargets)
+			if (entry.first == target)
+				return grow(entry.second, index);
+		indexedTargets.push_back({target, {}});
+		return grow(indexedTargets.back().second, index);
+	}
+
+	bool cachedUniform(GLint location, const void *data, size_t size)
+	{
+		if (location < 0)
+			return false;
+		if (currentProgram == UNKNOWN)
+		{
+			current.issued++;
+			return true;
+		}
+		std::vector<uint8_t> &value = uniforms[((uint64_t)currentProgram << 32) | (uint32_t)location];
+		if (value.size() == size && memcmp(value.data(), data, size) == 0)
+		{
+			current.filtered++;
+			return false;
+		}
+		value.assign((const uint8_t *)data, (const uint8_t *)data + size);
+		current.issued++;
+		return true;
+	}
+
+	GLuint currentProgram = UNKNOWN, currentVertexArray = UNKNOWN, currentFramebuffer = UNKNOWN;
+	GLuint currentDepthFunc = UNKNOWN, currentDepthMask = UNKNOWN, currentCullFace = UNKNOWN;
+	BlendState currentBlend;
+	GLfloat currentLineWidth = -1.0f, currentPointSize = -1.0f;
+	glm::vec4 currentClearColor = glm::vec4(-1.0f);
+	glm::ivec4 currentViewport = glm::ivec4(-1);
+	std::vector<std::pair<GLenum, GLuint>> targets, capabilities;
+	std::vector<std::pair<GLenum, std::vector<BufferRange>>> indexedTargets;
+	std::vector<GLuint> textureUnits;
+	std::vector<ImageUnit> imageUnits;
+	std::unordered_map<uint64_t, std::vector<uint8_t>> uniforms; // (programa, location) -> bytes
+	RenderStateStats current, last;
+};
+
+// Estado do contexto principal (só o thread principal desenha)
+inline RenderState &renderState()
+{
+	static RenderState state;
+	return state;
+}
@@ -0,0 +1,77 @@
+/* RenderTarget.h - framebuffer próprio (cor + profundidade em texturas)
+ *
+ * O framebuffer padrão da janela não pode ser lido por shaders. Quando algum
+ * passo precisa da profundidade do frame (por exemplo, a pirâmide Hi-Z do
+ * culling), a cena é desenhada aqui e a cor é copiada para a janela no final
+ * com glBlitNamedFramebuffer.
+ */
+
+#pragma once
+
+#include <iostream>
+
+#include <glad/glad.h>
+
+#include <RenderState.h>
+
+class RenderTarget
+{
+public:
+	~RenderTarget() { destroy(); }
+
+	bool create(GLsizei width, GLsizei height)
+	{
+		destroy();
+		framebufferWidth = width;
+		framebufferHeight = height;
+
+		glCreateTextures(GL_TEXTURE_2D, 1, &color);
+		glTextureStorage2D(color, 1, GL_RGBA8, width, height);
+		glCreateTextures(GL_TEXTURE_2D, 1, &depth);
+		glTextureStorage2D(depth, 1, GL_DEPTH_COMPONENT32F, width, height);
+		glTextureParameteri(depth, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+		glTextureParameteri(depth, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+		glCreateFramebuffers(1, &framebuffer);
+		glNamedFramebufferTexture(framebuffer, GL_COLOR_ATTACHMENT0, color, 0);
+		glNamedFramebufferTexture(framebuffer, GL_DEPTH_ATTACHMENT, depth, 0);
+		if (glCheckNamedFramebufferStatus(framebuffer, GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+		{
+			std::cout << "ERROR::FRAMEBUFFER::INCOMPLETE" << std::endl;
+			destroy();
+			return false;
+		}
+		return true;
+	}
+
+	void destroy()
+	{
+		if (framebuffer)
+			glDeleteFramebuffers(1, &framebuffer);
+		if (color)
+			glDeleteTextures(1, &color);
+		if (depth)
+			glDeleteTextures(1, &depth);
+		framebuffer = color = depth = 0;
+	}
+
+	void bind() const { renderState().bindFramebuffer(framebuffer); }
+
+	// Copia a cor para o framebuffer padrão (a janela) e volta a desenhar nele
+	void blitToScreen() const
+	{
+		glBlitNamedFramebuffer(framebuffer, 0, 0, 0, framebufferWidth, framebufferHeight, 0, 0, framebufferWidth, framebufferHeight,
+											 GL_COLOR_BUFFER_BIT, GL_NEAREST);
+		renderState().bindFramebuffer(0);
+	}
+
+	GLuint id() const { return framebuffer; }
+	GLuint colorTexture() const { return color; }
+	GLuint depthTexture() const { return depth; }
+	GLsizei width() const { return framebufferWidth; }
+	GLsizei height() const { return framebufferHeight; }
+
+private:
+	GLuint framebuffer = 0, color = 0, depth = 0;
+	GLsizei framebufferWidth = 0, framebufferHeight = 0;
+};
@@ -0,0 +1,219 @@
+/* ShaderManager.h - compilação assíncrona dos programas de shader
+ *
+ * Todos os programas são enviados ao driver de uma vez (submit) e nenhum
+ * status é consultado na hora: com KHR_parallel_shader_compile o driver
+ * compila e linka em threads próprias (glMaxShaderCompilerThreadsKHR com um
+ * thread por núcleo) e poll() só pergunta GL_COMPLETION_STATUS_KHR, que não
+ * bloqueia. Enquanto um programa não fica pronto, program() devolve o programa
+ * reserva passado pelo chamador, e o loop continua desenhando.
+ *
+ * Programas que estão no cache em disco (ProgramCache.h) ficam prontos já no
+ * submit. Sem a extensão, o primeiro poll() termina todos (bloqueando), mas o
+ * envio continua sendo feito todo antes da primeira consulta.
+ *
+ * Programas lidos de arquivos (submitFiles, ShaderSource.h) guardam a lista de
+ * arquivos usados, para o ShaderWatcher recompilar quando algum deles muda e
+ * trocar o programa com replace() entre dois frames.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include <Capabilities.h>
+#include <CpuProfiler.h>
+#include <Parallel.h>
+#include <ProgramCache.h>
+#include <ShaderSource.h>
+
+// Programa lido de arquivos, como o ShaderWatcher precisa para recompilar
+struct ShaderFileProgram
+{
+	size_t handle;
+	std::string name;
+	std::vector<ShaderFile> stages;
+	std::string defines;
+	std::vector<std::string> files; // estágios e tudo que eles incluem
+};
+
+class ShaderManager
+{
+public:
+	~ShaderManager() { destroy(); }
+
+	// Liga a compilação em paralelo do driver (se houver) com um thread por núcleo
+	void init()
+	{
+		parallel = capabilities().parallelShaderCompile;
+		if (parallel)
+			glMaxShaderCompilerThreadsKHR(workerThreadCount());
+	}
+
+	// Envia o programa para o driver e devolve o identificador usado em program()
+	size_t submit(const std::string &name, const std::vector<ShaderStage> &stages, const std::string &defines = "")
+	{
+		Entry entry;
+		entry.name = name;
+		entry.start = std::chrono::steady_clock::now();
+		entry.cached = programCacheSettings().enabled && programBinarySupported();
+		entry.key = entry.cached ? programCacheKey(stages, defines) : 0;
+
+		entry.program = entry.cached ? loadCachedProgram(name, entry.key) : 0;
+		if (entry.program)
+		{
+			entry.state = READY;
+			report(entry, "cache");
+		}
+		else
+		{
+			ProfileZone zone("compilar shader");
+			entry.pending = startCompile(stages, defines, entry.cached);
+			entry.state = PENDING;
+			pendingCount++;
+		}
+		entries.push_back(entry);
+		return entries.size() - 1;
+	}
+
+	// Lê os estágios dos arquivos (resolvendo os #include) e envia como em submit().
+	// Se algum arquivo não pôde ser lido, o programa já começa como falho.
+	size_t submitFiles(const std::string &name, const std::vector<ShaderFile> &stages, const std::string &defines = "")
+	{
+		std::vector<std::string> sources, files;
+		const bool loaded = loadShaderFiles(stages, sources, files);
+		size_t handle = entries.size();
+		if (loaded)
+		{
+			submit(name, shaderStages(stages, sources), defines);
+		}
+		else
+		{
+			Entry entry;
+			entry.name = name;
+			entry.state = FAILED;
+			entries.push_back(entry);
+		}
+		fileEntries.push_back({handle, name, stages, defines, files});
+		return handle;
+	}
+
+	// Troca o programa (já linkado) de um identificador, liberando o anterior
+	void replace(size_t handle, GLuint program)
+	{
+		Entry &entry = entries[handle];
+		if (entry.state == PENDING)
+			finish(entry);
+		if (entry.program)
+			glDeleteProgram(entry.program);
+		entry.program = program;
+		entry.state = READY;
+	}
+
+	const std::vector<ShaderFileProgram> &filePrograms() const { return fileEntries; }
+
+	// Recolhe os programas que o driver já terminou, sem esperar pelos outros
+	void poll()
+	{
+		if (pendingCount == 0)
+			return;
+		for (Entry &entry : entries)
+		{
+			if (entry.state != PENDING)
+				continue;
+			if (parallel)
+			{
+				GLint done = GL_FALSE;
+				glGetProgramiv(entry.pending.program, GL_COMPLETION_STATUS_KHR, &done);
+				if (!done)
+					continue;
+			}
+			finish(entry);
+		}
+	}
+
+	// Espera todos os programas (por exemplo, antes de medir desempenho)
+	void wait()
+	{
+		for (Entry &entry : entries)
+			if (entry.state == PENDING)
+				finish(entry);
+	}
+
+	// Programa pronto, ou fallback enquanto ele compila (ou se falhou)
+	GLuint program(size_t handle, GLuint fallback = 0) const
+	{
+		const Entry &entry = entries[handle];
+		return entry.state == READY ? entry.program : fallback;
+	}
+
+	bool ready(size_t handle) const { return entries[handle].state == READY; }
+	bool failed(size_t handle) const { return entries[handle].state == FAILED; }
+	size_t pending() const { return pendingCount; }
+
+	void destroy()
+	{
+		for (Entry &entry : entries)
+		{
+			if (entry.state == PENDING)
+				finish(entry);
+			if (entry.program)
+				glDeleteProgram(entry.program);
+		}
+		entries.clear();
+		fileEntries.clear();
+		pendingCount = 0;
+	}
+
+private:
+	enum State
+	{
+		PENDING,
+		READY,
+		FAILED
+	};
+
+	struct Entry
+	{
+		std::string name;
+		State state = PENDING;
+		GLuint program = 0;
+		PendingProgram pending;
+		bool cached = false;
+		uint64_t key = 0;
+		std::chrono::steady_clock::time_point start;
+	};
+
+	void finish(Entry &entry)
+	{
+		ProfileZone zone("ligar shader");
+		entry.program = finishCompile(entry.pending);
+		entry.state = entry.program ? READY : FAILED;
+		pendingCount--;
+		if (!entry.program)
+		{
+			for (const ShaderFileProgram &file : fileEntries)
+				if (&entries[file.handle] == &entry)
+					printShaderFiles(file.files);
+			return;
+		}
+		if (entry.cached)
+			writeProgramCache(entry.name, entry.key, entry.program);
+		report(entry, parallel ? "compilado em paralelo" : "compilado");
+	}
+
+	static void report(const Entry &entry, const char *how)
+	{
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - entry.start).count();
+		std::cout << "Programa " << entry.name << ": " << how << ", pronto em " << seconds * 1000.0 << " ms" << std::endl;
+	}
+
+	std::vector<Entry> entries;
+	std::vector<ShaderFileProgram> fileEntries;
+	size_t pendingCount = 0;
+	bool parallel = false;
+};
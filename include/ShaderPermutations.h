@@ -0,0 +1,150 @@
+/* ShaderPermutations.h - variantes de um programa de shader por recursos
+ *
+ * Cada recurso (instâncias animadas, lote, culling, ...) é um bit da chave
+ * ShaderKey e um #define no fonte. Uma variante é o programa compilado com os
+ * #defines dos bits ligados na chave. Nada é compilado na criação: a variante
+ * só vai para o ShaderManager (compilação assíncrona, cache em disco, recarga)
+ * na primeira vez que a chave é pedida, então combinações que nunca são usadas
+ * não custam tempo de início nem memória no driver.
+ *
+ * As variantes ficam numa tabela hash plana (endereçamento aberto, sondagem
+ * linear) indexada pela chave: a busca por frame é um acesso a um vetor.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include <ShaderManager.h>
+#include <ShaderSource.h>
+
+using ShaderKey = uint32_t;
+
+struct ShaderFeature
+{
+	ShaderKey bit;
+	const char *define;
+};
+
+// Tabela hash plana chave -> identificador no ShaderManager. A chave ~0 marca
+// posição vazia; a capacidade é potência de 2 e dobra acima de 50% de ocupação.
+class ShaderVariantTable
+{
+public:
+	static const ShaderKey EMPTY = ~(ShaderKey)0;
+
+	const size_t *find(ShaderKey key) const
+	{
+		if (slots.empty())
+			return nullptr;
+		for (size_t i = slot(key);; i = (i + 1) & (slots.size() - 1))
+		{
+			if (slots[i].key == key)
+				return &slots[i].handle;
+			if (slots[i].key == EMPTY)
+				return nullptr;
+		}
+	}
+
+	void insert(ShaderKey key, size_t handle)
+	{
+		if ((count + 1) * 2 > slots.size())
+			grow();
+		size_t i = slot(key);
+		while (slots[i].key != EMPTY && slots[i].key != key)
+			i = (i + 1) & (slots.size() - 1);
+		if (slots[i].key == EMPTY)
+			count++;
+		slots[i] = {key, handle};
+	}
+
+	size_t size() const { return count; }
+
+	void clear()
+	{
+		slots.clear();
+		count = 0;
+	}
+
+private:
+	struct Slot
+	{
+		ShaderKey key;
+		size_t handle;
+	};
+
+	// Mistura os bits (as chaves são pequenas e parecidas)
+	size_t slot(ShaderKey key) const { return (size_t)((key * 0x9E3779B1u) >> 7) & (slots.size() - 1); }
+
+	void grow()
+	{
+		std::vector<Slot> old;
+		old.swap(slots);
+		slots.assign(old.empty() ? 16 : old.size() * 2, {EMPTY, 0});
+		count = 0;
+		for (const Slot &s : old)
+			if (s.key != EMPTY)
+				insert(s.key, s.handle);
+	}
+
+	std::vector<Slot> slots;
+	size_t count = 0;
+};
+
+class ShaderPermutations
+{
+public:
+	// Só guarda a receita; nenhuma variante é compilada aqui
+	void create(ShaderManager &shaders, const std::string &name, const std::vector<ShaderFile> &stages,
+							const std::string &defines, const std::vector<ShaderFeature> &features)
+	{
+		manager = &shaders;
+		baseName = name;
+		files = stages;
+		baseDefines = defines;
+		featureList = features;
+		variants.clear();
+	}
+
+	// Envia a variante para compilação, se ainda não foi (não espera)
+	size_t request(ShaderKey key)
+	{
+		if (const size_t *handle = variants.find(key))
+			return *handle;
+		std::string defines = baseDefines;
+		for (const ShaderFeature &feature : featureList)
+			if (key & feature.bit)
+				defines += std::string("#define ") + feature.define + "\n";
+		size_t handle = manager->submitFiles(variantName(key), files, defines);
+		variants.insert(key, handle);
+		return handle;
+	}
+
+	// Programa da variante, ou fallback enquanto ela compila
+	GLuint program(ShaderKey key, GLuint fallback = 0) { return manager->program(request(key), fallback); }
+	bool ready(ShaderKey key) { return manager->ready(request(key)); }
+
+	size_t compiledVariants() const { return variants.size(); }
+
+	// Nome da variante (também o nome do arquivo no cache de programas)
+	std::string variantName(ShaderKey key) const
+	{
+		std::string name = baseName;
+		for (const ShaderFeature &feature : featureList)
+			if (key & feature.bit)
+				name += std::string("-") + feature.define;
+		return name;
+	}
+
+private:
+	ShaderManager *manager = nullptr;
+	std::string baseName;
+	std::vector<ShaderFile> files;
+	std::string baseDefines;
+	std::vector<ShaderFeature> featureList;
+	ShaderVariantTable variants;
+};
@@ -0,0 +1,138 @@
+/* ShaderSource.h - leitura dos shaders em arquivo, com #include
+ *
+ * Os fontes GLSL ficam em shaders/. Antes de ir para o driver, cada estágio
+ * passa por um pré-processador pequeno:
+ *  - #include "arquivo" é trocado pelo conteúdo do arquivo (caminho relativo
+ *    ao arquivo que inclui). Cada arquivo entra uma vez só por estágio, o que
+ *    também corta inclusões circulares;
+ *  - diretivas #line mantêm os números de linha: nos erros do driver, "N(L)"
+ *    é a linha L do arquivo N da lista de fontes do programa.
+ * Os #defines são injetados depois, por startCompile (ProgramCache.h), logo
+ * após a linha do #version.
+ */
+
+#pragma once
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include <ProgramCache.h>
+
+// Diretório padrão dos shaders (o CMakelists.txt aponta para shaders/ do projeto)
+#ifndef SHADER_DIRECTORY
+#define SHADER_DIRECTORY "shaders"
+#endif
+
+struct ShaderFile
+{
+	GLenum type;
+	std::string path;
+};
+
+// Caminho normalizado: é o que aparece na lista de fontes e o que é vigiado para recarga
+inline std::string shaderPath(const std::filesystem::path &path)
+{
+	return path.lexically_normal().generic_string();
+}
+
+inline size_t shaderSourceIndex(std::vector<std::string> &files, const std::string &path)
+{
+	for (size_t i = 0; i < files.size(); i++)
+		if (files[i] == path)
+			return i;
+	files.push_back(path);
+	return files.size() - 1;
+}
+
+// Anexa o arquivo em out resolvendo os #include. files é a lista de fontes do
+// programa inteiro (o índice usado nos #line); included, os já incluídos neste estágio.
+inline bool preprocessShader(const std::string &path, std::string &out, std::vector<std::string> &files, std::set<std::string> &included)
+{
+	std::ifstream in(path);
+	if (!in)
+	{
+		std::cout << "ERROR::SHADER::FILE_NOT_FOUND " << path << std::endl;
+		return false;
+	}
+	included.insert(path);
+	const size_t index = shaderSourceIndex(files, path);
+
+	std::string line;
+	int lineNumber = 0;
+	while (std::getline(in, line))
+	{
+		lineNumber++;
+		size_t start = line.find_first_not_of(" \t");
+		if (start != std::string::npos && line.compare(start, 8, "#include") == 0)
+		{
+			size_t open = line.find('"', start + 8);
+			size_t close = open == std::string::npos ? open : line.find('"', open + 1);
+			if (close == std::string::npos)
+			{
+				std::cout << "ERROR::SHADER::INVALID_INCLUDE " << path << ":" << lineNumber << std::endl;
+				return false;
+			}
+			std::filesystem::path parent = std::filesystem::path(path).parent_path();
+			std::string target = shaderPath(parent / line.substr(open + 1, close - open - 1));
+			if (!included.count(target))
+			{
+				out += "#line 1 " + std::to_string(shaderSourceIndex(files, target)) + "\n";
+				if (!preprocessShader(target, out, files, included))
+				{
+					std::cout << "  incluido em " << path << ":" << lineNumber << std::endl;
+					return false;
+				}
+			}
+			out += "#line " + std::to_string(lineNumber + 1) + " " + std::to_string(index) + "\n";
+			continue;
+		}
+		out += line;
+		out += '\n';
+		// Depois do #version (onde os defines são injetados) a contagem recomeça
+		if (start != std::string::npos && line.compare(start, 8, "#version") == 0)
+			out += "#line " + std::to_string(lineNumber + 1) + " " + std::to_string(index) + "\n";
+	}
+	return true;
+}
+
+// Lê e pré-processa todos os estágios. files recebe os arquivos usados (os
+// estágios e tudo que eles incluem), mesmo se falhar, para a recarga vigiar.
+inline bool loadShaderFiles(const std::vector<ShaderFile> &stages, std::vector<std::string> &sources, std::vector<std::string> &files)
+{
+	sources.clear();
+	files.clear();
+	for (const ShaderFile &stage : stages)
+		shaderSourceIndex(files, shaderPath(stage.path));
+
+	bool ok = true;
+	for (const ShaderFile &stage : stages)
+	{
+		std::string source;
+		std::set<std::string> included;
+		ok = preprocessShader(shaderPath(stage.path), source, files, included) && ok;
+		sources.push_back(source);
+	}
+	return ok;
+}
+
+// Estágios prontos para startCompile (apontam para o texto em sources)
+inline std::vector<ShaderStage> shaderStages(const std::vector<ShaderFile> &stages, const std::vector<std::string> &sources)
+{
+	std::vector<ShaderStage> result;
+	for (size_t i = 0; i < stages.size(); i++)
+		result.push_back({stages[i].type, sources[i].c_str()});
+	return result;
+}
+
+// Lista de fontes do programa, para ler os erros do driver ("N(L)" = arquivo N, linha L)
+inline void printShaderFiles(const std::vector<std::string> &files)
+{
+	for (size_t i = 0; i < files.size(); i++)
+		std::cout << "  fonte " << i << ": " << files[i] << std::endl;
+}
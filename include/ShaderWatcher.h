@@ -0,0 +1,261 @@
+/* ShaderWatcher.h - recarga dos shaders em arquivo quando eles mudam
+ *
+ * Um thread vigia (inotify) os diretórios de todos os arquivos usados pelos
+ * programas de ShaderManager::submitFiles. Quando um arquivo muda, os
+ * programas que dependem dele são pré-processados e compilados de novo nesse
+ * thread, num contexto OpenGL próprio (janela invisível que compartilha os
+ * objetos com a janela principal), então o frame nunca espera o compilador.
+ *
+ * O programa novo só é entregue depois de um glFinish no contexto do thread;
+ * apply(), chamado pelo loop entre dois frames, troca o programa no
+ * ShaderManager de uma vez. Se a compilação falhar, o erro é impresso e o
+ * programa anterior continua em uso.
+ *
+ * Programas enviados depois do start() (variantes compiladas na primeira vez
+ * que são usadas, ShaderPermutations.h) passam a ser vigiados no apply().
+ *
+ * Limitação: só no Linux (inotify). Nos outros sistemas start() avisa e não faz nada.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <glad/glad.h>
+#include <GLFW/glfw3.h>
+
+#include <ProgramCache.h>
+#include <ShaderManager.h>
+#include <ShaderSource.h>
+
+#ifdef __linux__
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+class ShaderWatcher
+{
+public:
+	~ShaderWatcher() { stop(); }
+
+	// Começa a vigiar os programas em arquivo do ShaderManager.
+	// Precisa ser chamado no thread principal (cria a janela do contexto).
+	bool start(GLFWwindow *window, const ShaderManager &shaders)
+	{
+		stop();
+#ifdef __linux__
+		inotifyFd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		if (inotifyFd < 0)
+		{
+			std::cout << "ERROR::SHADER_WATCHER::INOTIFY_FAILED" << std::endl;
+			return false;
+		}
+		added = shaders.filePrograms();
+		known = added.size();
+
+		glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+		context = glfwCreateWindow(1, 1, "shader reload", nullptr, window);
+		glfwWindowHint(GLFW_VISIBLE, GLFW_TRUE);
+		if (!context)
+		{
+			std::cout << "ERROR::SHADER_WATCHER::CONTEXT_FAILED" << std::endl;
+			stop();
+			return false;
+		}
+		running = true;
+		worker = std::thread([this]()
+												 { run(); });
+		return true;
+#else
+		(void)window;
+		std::cout << "Recarga de shaders: so no Linux (inotify)" << std::endl;
+		return false;
+#endif
+	}
+
+	// Entre dois frames: troca os programas que o thread já recompilou e
+	// passa para ele os programas enviados desde a última chamada
+	void apply(ShaderManager &shaders)
+	{
+		if (!running)
+			return;
+		std::vector<Reloaded> done;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			done.swap(reloaded);
+			const std::vector<ShaderFileProgram> &all = shaders.filePrograms();
+			added.insert(added.end(), all.begin() + known, all.end());
+			known = all.size();
+		}
+		for (const Reloaded &program : done)
+		{
+			shaders.replace(program.handle, program.program);
+			std::cout << "Programa " << program.name << ": recarregado em " << program.seconds * 1000.0 << " ms" << std::endl;
+		}
+	}
+
+	bool active() const { return running; }
+
+	void stop()
+	{
+		running = false;
+		if (worker.joinable())
+			worker.join();
+		if (context)
+			glfwDestroyWindow(context);
+		context = nullptr;
+#ifdef __linux__
+		if (inotifyFd >= 0)
+			close(inotifyFd);
+#endif
+		inotifyFd = -1;
+		watches.clear();
+		// Programas recompilados que não chegaram a ser trocados
+		for (const Reloaded &program : reloaded)
+			glDeleteProgram(program.program);
+		reloaded.clear();
+		programs.clear();
+		added.clear();
+		known = 0;
+	}
+
+private:
+	struct Reloaded
+	{
+		std::string name;
+		size_t handle; // no ShaderManager
+		GLuint program;
+		double seconds;
+	};
+
+#ifdef __linux__
+	// Vigia os diretórios (editores costumam salvar num arquivo novo e renomear)
+	void watchFiles(const std::vector<std::string> &files)
+	{
+		for (const std::string &file : files)
+		{
+			std::string directory = std::filesystem::path(file).parent_path().generic_string();
+			if (directory.empty())
+				directory = ".";
+			bool watched = false;
+			for (const auto &watch : watches)
+				watched = watched || watch.second == directory;
+			if (watched)
+				continue;
+			int wd = inotify_add_watch(inotifyFd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+			if (wd >= 0)
+				watches[wd] = directory;
+		}
+	}
+
+	// Arquivos alterados desde a última leitura (lê tudo que estiver na fila)
+	void readChanges(std::vector<std::string> &changed)
+	{
+		alignas(inotify_event) char buffer[4096];
+		ssize_t length;
+		while ((length = read(inotifyFd, buffer, sizeof(buffer))) > 0)
+		{
+			for (char *p = buffer; p < buffer + length;)
+			{
+				const inotify_event *event = (const inotify_event *)p;
+				p += sizeof(inotify_event) + event->len;
+				auto watch = watches.find(event->wd);
+				if (watch == watches.end() || event->len == 0)
+					continue;
+				std::string path = shaderPath(std::filesystem::path(watch->second) / event->name);
+				if (std::find(changed.begin(), changed.end(), path) == changed.end())
+					changed.push_back(path);
+			}
+		}
+	}
+
+	void run()
+	{
+		glfwMakeContextCurrent(context);
+		while (running)
+		{
+			// Programas novos entram na lista do thread
+			{
+				std::lock_guard<std::mutex> lock(mutex);
+				for (const ShaderFileProgram &program : added)
+				{
+					watchFiles(program.files);
+					programs.push_back(program);
+				}
+				added.clear();
+			}
+			pollfd fd = {inotifyFd, POLLIN, 0};
+			if (poll(&fd, 1, 100) <= 0)
+				continue;
+			// Um salvamento costuma gerar vários eventos seguidos: espera todos chegarem
+			std::vector<std::string> changed;
+			readChanges(changed);
+			std::this_thread::sleep_for(std::chrono::milliseconds(50));
+			readChanges(changed);
+
+			for (size_t i = 0; i < programs.size() && running; i++)
+			{
+				bool affected = false;
+				for (const std::string &path : changed)
+					affected = affected || std::find(programs[i].files.begin(), programs[i].files.end(), path) != programs[i].files.end();
+				if (affected)
+					reload(programs[i]);
+			}
+		}
+		glfwMakeContextCurrent(nullptr);
+	}
+#endif
+
+	// Recompila no contexto do thread; em caso de erro o programa atual fica
+	void reload(ShaderFileProgram &program)
+	{
+		auto start = std::chrono::steady_clock::now();
+		std::vector<std::string> sources, files;
+		const bool loaded = loadShaderFiles(program.stages, sources, files);
+#ifdef __linux__
+		// Um #include novo também passa a ser vigiado
+		watchFiles(files);
+#endif
+		program.files = files;
+
+		const bool cached = programCacheSettings().enabled && programBinarySupported();
+		std::vector<ShaderStage> stages = shaderStages(program.stages, sources);
+		GLuint id = loaded ? compileProgram(stages, program.defines, cached) : 0;
+		if (!id)
+		{
+			if (loaded)
+				printShaderFiles(files);
+			std::cout << "ERROR::SHADER::RELOAD_FAILED " << program.name << " (mantendo o programa anterior)" << std::endl;
+			return;
+		}
+		if (cached)
+			writeProgramCache(program.name, programCacheKey(stages, program.defines), id);
+		// O programa precisa estar pronto antes de ser usado no outro contexto
+		glFinish();
+
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		std::lock_guard<std::mutex> lock(mutex);
+		reloaded.push_back({program.name, program.handle, id, seconds});
+	}
+
+	std::vector<ShaderFileProgram> programs; // só o thread mexe depois do start
+	std::vector<ShaderFileProgram> added;		 // novos, esperando o thread (protegido por mutex)
+	size_t known = 0;												 // programas do ShaderManager já passados ao thread
+	GLFWwindow *context = nullptr;
+	std::thread worker;
+	std::atomic<bool> running{false};
+	std::mutex mutex;
+	std::vector<Reloaded> reloaded;
+	int inotifyFd = -1;
+	std::map<int, std::string> watches; // descritor do inotify -> diretório
+};
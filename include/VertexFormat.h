@@ -0,0 +1,275 @@
+/* VertexFormat.h - descritor do formato de vértice na GPU
+ *
+ * Em vez de strides e offsets fixos em glVertexAttribPointer, cada malha leva um
+ * VertexFormat que diz como cada atributo está codificado no VBO. A configuração
+ * do VAO é gerada a partir do descritor (applyVertexFormat), com as funções de
+ * acesso direto (DSA): o VAO é editado pelo nome, sem ser vinculado.
+ *
+ * Codificações disponíveis:
+ *  - posição: float (12 bytes), half-float ou snorm16 (6 bytes + 2 de alinhamento)
+ *  - cor: float (12 bytes) ou RGBA8 normalizado (4 bytes)
+ *
+ * Com snorm16 as posições são guardadas relativas à caixa envolvente da malha
+ * (valores em [-1, 1]); a escala/deslocamento para voltar às coordenadas
+ * originais é aplicada na matriz de modelo (vertexDequantization).
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+
+// Um vértice do modelo, na precisão completa usada na CPU: posição (x, y, z) e cor (r, g, b)
+struct Vertex
+{
+	glm::vec3 position;
+	glm::vec3 color;
+};
+
+enum PositionEncoding
+{
+	POSITION_FLOAT32,
+	POSITION_HALF,
+	POSITION_SNORM16
+};
+
+enum ColorEncoding
+{
+	COLOR_FLOAT32,
+	COLOR_UNORM8
+};
+
+struct VertexAttribute
+{
+	GLuint location;
+	GLint components;
+	GLenum type;
+	GLboolean normalized;
+	GLuint offset;
+};
+
+const int MAX_VERTEX_ATTRIBUTES = 4;
+
+struct VertexFormat
+{
+	PositionEncoding position = POSITION_FLOAT32;
+	ColorEncoding color = COLOR_FLOAT32;
+
+	VertexAttribute attributes[MAX_VERTEX_ATTRIBUTES];
+	int attributeCount = 0;
+	GLsizei stride = 0;
+
+	// Posição original = posição armazenada * positionScale + positionBias
+	glm::vec3 positionScale = glm::vec3(1.0f);
+	glm::vec3 positionBias = glm::vec3(0.0f);
+};
+
+// Monta o layout (offsets, tipos e stride) para as codificações escolhidas
+inline VertexFormat makeVertexFormat(PositionEncoding position, ColorEncoding color)
+{
+	VertexFormat format;
+	format.position = position;
+	format.color = color;
+
+	GLuint offset = 0;
+	switch (position)
+	{
+	case POSITION_FLOAT32:
+		format.attributes[0] = {0, 3, GL_FLOAT, GL_FALSE, offset};
+		offset += 3 * sizeof(GLfloat);
+		break;
+	case POSITION_HALF:
+		format.attributes[0] = {0, 3, GL_HALF_FLOAT, GL_FALSE, offset};
+		offset += 4 * sizeof(GLhalf); // 3 componentes + 1 de alinhamento
+		break;
+	case POSITION_SNORM16:
+		format.attributes[0] = {0, 3, GL_SHORT, GL_TRUE, offset};
+		offset += 4 * sizeof(GLshort); // 3 componentes + 1 de alinhamento
+		break;
+	}
+
+	if (color == COLOR_FLOAT32)
+	{
+		format.attributes[1] = {1, 3, GL_FLOAT, GL_FALSE, offset};
+		offset += 3 * sizeof(GLfloat);
+	}
+	else
+	{
+		format.attributes[1] = {1, 4, GL_UNSIGNED_BYTE, GL_TRUE, offset};
+		offset += 4 * sizeof(GLubyte);
+	}
+
+	format.attributeCount = 2;
+	format.stride = (GLsizei)offset;
+	return format;
+}
+
+// Lê o formato a partir de um nome ("float", "half" ou "snorm16")
+inline bool parseVertexFormat(const std::string &name, VertexFormat &format)
+{
+	if (name == "float")
+		format = makeVertexFormat(POSITION_FLOAT32, COLOR_FLOAT32);
+	else if (name == "half")
+		format = makeVertexFormat(POSITION_HALF, COLOR_UNORM8);
+	else if (name == "snorm16")
+		format = makeVertexFormat(POSITION_SNORM16, COLOR_UNORM8);
+	else
+		return false;
+	return true;
+}
+
+inline const char *vertexFormatName(const VertexFormat &format)
+{
+	switch (format.position)
+	{
+	case POSITION_HALF:
+		return "half";
+	case POSITION_SNORM16:
+		return "snorm16";
+	default:
+		return "float";
+	}
+}
+
+// Conversão float -> half (IEEE 754 binary16), arredondando para o mais próximo
+inline GLhalf floatToHalf(float value)
+{
+	uint32_t f;
+	memcpy(&f, &value, sizeof(f));
+
+	uint32_t sign = (f >> 16) & 0x8000;
+	int32_t exponent = (int32_t)((f >> 23) & 0xff) - 127 + 15;
+	uint32_t mantissa = f & 0x7fffff;
+
+	if (((f >> 23) & 0xff) == 0xff) // infinito ou NaN
+		return (GLhalf)(sign | 0x7c00 | (mantissa ? 0x200 : 0));
+	if (exponent >= 31) // grande demais: satura em infinito
+		return (GLhalf)(sign | 0x7c00);
+	if (exponent <= 0) // subnormal (ou zero)
+	{
+		if (exponent < -10)
+			return (GLhalf)sign;
+		mantissa |= 0x800000;
+		uint32_t shift = (uint32_t)(14 - exponent);
+		uint32_t half = mantissa >> shift;
+		uint32_t rest = mantissa & ((1u << shift) - 1);
+		uint32_t halfway = 1u << (shift - 1);
+		if (rest > halfway || (rest == halfway && (half & 1)))
+			half++;
+		return (GLhalf)(sign | half);
+	}
+
+	uint32_t half = sign | ((uint32_t)exponent << 10) | (mantissa >> 13);
+	uint32_t rest = mantissa & 0x1fff;
+	if (rest > 0x1000 || (rest == 0x1000 && (half & 1)))
+		half++; // pode propagar para o expoente, o que também está correto
+	return (GLhalf)half;
+}
+
+inline GLshort floatToSnorm16(float value)
+{
+	value = std::min(std::max(value, -1.0f), 1.0f);
+	return (GLshort)std::lround(value * 32767.0f);
+}
+
+inline GLubyte floatToUnorm8(float value)
+{
+	value = std::min(std::max(value, 0.0f), 1.0f);
+	return (GLubyte)std::lround(value * 255.0f);
+}
+
+// Codifica os vértices no formato pedido. Para snorm16 calcula também a
+// escala/deslocamento a partir da caixa envolvente das posições.
+inline std::vector<uint8_t> packVertices(const std::vector<Vertex> &vertices, VertexFormat &format)
+{
+	format.positionScale = glm::vec3(1.0f);
+	format.positionBias = glm::vec3(0.0f);
+
+	if (format.position == POSITION_SNORM16 && !vertices.empty())
+	{
+		glm::vec3 minimum = vertices[0].position, maximum = vertices[0].position;
+		for (const Vertex &v : vertices)
+		{
+			minimum = glm::min(minimum, v.position);
+			maximum = glm::max(maximum, v.position);
+		}
+		format.positionBias = (minimum + maximum) * 0.5f;
+		format.positionScale = (maximum - minimum) * 0.5f;
+		for (int i = 0; i < 3; i++)
+			if (format.positionScale[i] <= 0.0f)
+				format.positionScale[i] = 1.0f;
+	}
+
+	std::vector<uint8_t> data(vertices.size() * format.stride, 0);
+	const GLuint positionOffset = format.attributes[0].offset;
+	const GLuint colorOffset = format.attributes[1].offset;
+
+	for (size_t i = 0; i < vertices.size(); i++)
+	{
+		uint8_t *dst = data.data() + i * format.stride;
+		const Vertex &v = vertices[i];
+
+		switch (format.position)
+		{
+		case POSITION_FLOAT32:
+			memcpy(dst + positionOffset, &v.position, 3 * sizeof(GLfloat));
+			break;
+		case POSITION_HALF:
+		{
+			GLhalf p[3] = {floatToHalf(v.position.x), floatToHalf(v.position.y), floatToHalf(v.position.z)};
+			memcpy(dst + positionOffset, p, sizeof(p));
+			break;
+		}
+		case POSITION_SNORM16:
+		{
+			glm::vec3 n = (v.position - format.positionBias) / format.positionScale;
+			GLshort p[3] = {floatToSnorm16(n.x), floatToSnorm16(n.y), floatToSnorm16(n.z)};
+			memcpy(dst + positionOffset, p, sizeof(p));
+			break;
+		}
+		}
+
+		if (format.color == COLOR_FLOAT32)
+		{
+			memcpy(dst + colorOffset, &v.color, 3 * sizeof(GLfloat));
+		}
+		else
+		{
+			GLubyte c[4] = {floatToUnorm8(v.color.r), floatToUnorm8(v.color.g), floatToUnorm8(v.color.b), 255};
+			memcpy(dst + colorOffset, c, sizeof(c));
+		}
+	}
+
+	return data;
+}
+
+// Ponto de ligação (binding) do VAO por onde chegam os vértices da malha
+const GLuint VERTEX_BUFFER_BINDING = 0;
+
+// Liga o VBO ao VAO e descreve cada atributo a partir do formato
+inline void applyVertexFormat(GLuint VAO, GLuint VBO, const VertexFormat &format)
+{
+	glVertexArrayVertexBuffer(VAO, VERTEX_BUFFER_BINDING, VBO, 0, format.stride);
+	for (int i = 0; i < format.attributeCount; i++)
+	{
+		const VertexAttribute &attr = format.attributes[i];
+		glVertexArrayAttribFormat(VAO, attr.location, attr.components, attr.type, attr.normalized, attr.offset);
+		glVertexArrayAttribBinding(VAO, attr.location, VERTEX_BUFFER_BINDING);
+		glEnableVertexArrayAttrib(VAO, attr.location);
+	}
+}
+
+// Matriz que leva as posições armazenadas de volta ao espaço do modelo
+inline glm::mat4 vertexDequantization(const VertexFormat &format)
+{
+	glm::mat4 m = glm::translate(glm::mat4(1.0f), format.positionBias);
+	return glm::scale(m, format.positionScale);
+}
@@ -0,0 +1,10 @@
+// Dados do lote (MeshBatch.h): matriz de cada comando (gl_DrawID), de cada
+// objeto e a lista de objetos visíveis escrita pelo culling.
+// Os bindings vêm como #define do programa (os mesmos números do C++).
+layout (std430, binding = BATCH_DRAW_BINDING) readonly buffer BatchDraws { mat4 batchDraws[]; };
+layout (std430, binding = BATCH_OBJECT_BINDING) readonly buffer BatchObjects { mat4 batchObjects[]; };
+#ifdef CULLED
+layout (std430, binding = BATCH_VISIBLE_BINDING) readonly buffer VisibleObjects { uint visibleObjects[]; };
+#endif
+
+uniform int batchDrawOffset;
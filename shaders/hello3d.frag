@@ -0,0 +1,8 @@
+#version 450
+in vec4 finalColor;
+out vec4 color;
+
+void main()
+{
+	color = finalColor;
+}
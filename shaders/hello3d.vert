@@ -0,0 +1,33 @@
+#version 450
+// Variantes (ShaderPermutations.h): STREAMED, BATCHED e CULLED vêm como #define
+#ifdef BATCHED
+#extension GL_ARB_shader_draw_parameters : require
+#include "batch.glsl"
+#endif
+
+layout (location = 0) in vec3 position;
+layout (location = 1) in vec3 color;
+layout (location = 2) in mat4 instanceModel;
+#ifdef STREAMED
+layout (std430, binding = STREAMED_INSTANCE_BINDING) readonly buffer StreamedInstances { mat4 streamedModels[]; };
+#endif
+uniform mat4 model;
+out vec4 finalColor;
+
+void main()
+{
+#if defined(BATCHED)
+	// Com culling, o comando só tem os objetos visíveis, listados pelo compute shader
+	uint object = gl_BaseInstanceARB + gl_InstanceID;
+#ifdef CULLED
+	object = visibleObjects[object];
+#endif
+	mat4 instance = batchObjects[object] * batchDraws[batchDrawOffset + gl_DrawIDARB];
+#elif defined(STREAMED)
+	mat4 instance = streamedModels[gl_InstanceID];
+#else
+	mat4 instance = instanceModel;
+#endif
+	gl_Position = model * instance * vec4(position, 1.0);
+	finalColor = vec4(color, 1.0);
+}
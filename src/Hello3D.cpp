@@ -8,6 +8,9 @@
 
 #include <iostream>
 #include <string>
+#include <chrono>
+#include <random>
+#include <cstdio>
 #include <assert.h>
 
 using namespace std;
@@ -23,74 +26,213 @@ using namespace std;
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
+// Malhas indexadas
+#include <Capabilities.h>
+#include <Mesh.h>
+#include <MeshCache.h>
+#include <MeshLoader.h>
+#include <MeshOptimizer.h>
+
+// Instâncias
+#include <Instancing.h>
+#include <FrameRing.h>
+#include <MeshBatch.h>
+#include <RenderTarget.h>
+#include <GpuCulling.h>
+#include <CpuCulling.h>
+#include <ProgramCache.h>
+#include <ShaderManager.h>
+#include <ShaderPermutations.h>
+#include <ShaderWatcher.h>
+#include <RenderState.h>
+#include <RenderQueue.h>
+#include <JobSystem.h>
+#include <Headless.h>
+#include <FrameBenchmark.h>
+#include <GpuProfiler.h>
+#include <CpuProfiler.h>
+#include <FrameCapture.h>
+
+// Implementação da stb_image_write (usada pela captura), só nesta unidade
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#include <stb_image_write.h>
+
 // Protótipo da função de callback de teclado
 void key_callback(GLFWwindow *window, int key, int scancode, int action, int mode);
 
 // Protótipos das funções
-int setupShader();
-int setupGeometry();
+void setupShader(ShaderManager &shaders, ShaderPermutations &permutations, GLuint &fallbackProgram);
+GPUMesh setupGeometry(const VertexFormat &format);
+bool setupBatch(const GPUMesh &object, const glm::mat4 &objectTransform, const std::vector<glm::mat4> &placements,
+								MeshArena &arena, DrawBatch &batch);
+int runCullBenchmark(size_t count);
+int runJobBenchmark(size_t count);
+bool parseArguments(int argc, char **argv);
+void printUsage(const char *program);
+double elapsedSeconds();
+string commandLine(int argc, char **argv);
 
 // Dimensões da janela (pode ser alterado em tempo de execução)
 const GLuint WIDTH = 1000, HEIGHT = 1000;
 
-// Código fonte do Vertex Shader (em GLSL): ainda hardcoded
-const GLchar *vertexShaderSource = "#version 450\n"
-																	 "layout (location = 0) in vec3 position;\n"
-																	 "layout (location = 1) in vec3 color;\n"
-																	 "uniform mat4 model;\n"
-																	 "out vec4 finalColor;\n"
-																	 "void main()\n"
-																	 "{\n"
-																	 //...pode ter mais linhas de código aqui!
-																	 "gl_Position = model * vec4(position, 1.0);\n"
-																	 "finalColor = vec4(color, 1.0);\n"
-																	 "}\0";
-
-// Códifo fonte do Fragment Shader (em GLSL): ainda hardcoded
-const GLchar *fragmentShaderSource = "#version 450\n"
-																		 "in vec4 finalColor;\n"
-																		 "out vec4 color;\n"
-																		 "void main()\n"
-																		 "{\n"
-																		 "color = finalColor;\n"
-																		 "}\n\0";
+// Os shaders ficam em arquivos (shaders/hello3d.vert e hello3d.frag), lidos
+// de options.shaderDirectory e recarregados quando mudam (ShaderWatcher.h)
+
+// Binding do SSBO das instâncias animadas (--stream)
+const GLuint STREAMED_INSTANCE_BINDING = 0;
+
+// Recursos do programa: cada combinação é uma variante compilada à parte
+// (ShaderPermutations.h), só quando é usada pela primeira vez
+const ShaderKey SHADER_STREAMED = 1 << 0; // matrizes das instâncias no SSBO do buffer circular
+const ShaderKey SHADER_BATCHED = 1 << 1;	// lote com multi-draw indireto (gl_DrawID, gl_BaseInstance)
+const ShaderKey SHADER_CULLED = 1 << 2;		// comandos com só os objetos visíveis (lista do culling)
+
+// Programa reserva, desenhado enquanto o driver compila o principal (ou se
+// os arquivos não compilam): só a matriz do objeto e a do atributo de
+// instância, sem os SSBOs. Fica no código para nunca depender dos arquivos.
+const GLchar *fallbackVertexShaderSource = "#version 450\n"
+																					 "layout (location = 0) in vec3 position;\n"
+																					 "layout (location = 1) in vec3 color;\n"
+																					 "layout (location = 2) in mat4 instanceModel;\n"
+																					 "uniform mat4 model;\n"
+																					 "out vec4 finalColor;\n"
+																					 "void main()\n"
+																					 "{\n"
+																					 "gl_Position = model * instanceModel * vec4(position, 1.0);\n"
+																					 "finalColor = vec4(color, 1.0);\n"
+																					 "}\0";
+
+const GLchar *fallbackFragmentShaderSource = "#version 450\n"
+																						 "in vec4 finalColor;\n"
+																						 "out vec4 color;\n"
+																						 "void main()\n"
+																						 "{\n"
+																						 "color = finalColor;\n"
+																						 "}\n\0";
 
 bool rotateX = false, rotateY = false, rotateZ = false;
+// Tecla T: grava o perfil da CPU no fim do frame
+bool traceRequested = false;
+
+// Opções de linha de comando (ver printUsage)
+struct Options
+{
+	// Formato dos vértices no VBO: snorm16 + RGBA8 = 12 bytes por vértice
+	VertexFormat vertexFormat = makeVertexFormat(POSITION_SNORM16, COLOR_UNORM8);
+	// Malha .obj/.ply a ser desenhada no lugar da pirâmide
+	string meshPath;
+	// Usa o cache binário da malha (arquivo.meshcache)
+	bool meshCache = true;
+	// Usa o cache dos programas de shader já linkados (.programcache/)
+	bool programCache = true;
+	// Diretório dos arquivos de shader
+	string shaderDirectory = SHADER_DIRECTORY;
+	// Recompila os shaders quando os arquivos mudam
+	bool hotReload = true;
+	// Número de cópias da malha (0 = um objeto só, como antes)
+	size_t instanceCount = 0;
+	// Desenha as cópias uma a uma (glUniformMatrix4fv + glDrawElements) em vez de instanciado
+	bool perObject = false;
+	// Anima as cópias na CPU e envia as matrizes a cada frame pelo buffer circular
+	bool stream = false;
+	unsigned framesInFlight = 3;
+	// Coloca as malhas numa arena única e desenha tudo com glMultiDrawElementsIndirect
+	bool batch = false;
+	// Culling do lote na GPU (frustum + Hi-Z do frame anterior) antes do multi-draw
+	bool cull = false;
+	// O mesmo culling (só frustum) feito na CPU, com SIMD e threads
+	bool cullOnCpu = false;
+	// Só mede o culling na CPU com esse número de esferas (sem janela)
+	size_t benchCullObjects = 0;
+	// Só mede o agendador de tarefas num frame simulado com esse número de objetos (sem janela)
+	size_t benchJobObjects = 0;
+	// Sem janela nem display: contexto EGL surfaceless, desenho num framebuffer próprio
+	bool headless = false;
+	// Tamanho da janela (ou do framebuffer sem janela)
+	int width = WIDTH, height = HEIGHT;
+	// Para depois desse número de frames (0 = até fechar a janela)
+	size_t frames = 0;
+	// Benchmark reprodutível: passo fixo, aquecimento, percentis (FrameBenchmark.h)
+	bool benchmark = false;
+	size_t warmupFrames = 60;
+	string benchJson, benchCsv;
+	// Tempo de GPU por trecho do frame, com consultas de carimbo de tempo (GpuProfiler.h)
+	bool gpuProfile = false;
+	// Zonas de tempo de CPU por thread, gravadas em JSON (Chrome Trace) ao sair e na tecla T
+	string tracePath;
+	// Grava os frames: vídeo .y4m, ou prefixo de PNGs (FrameCapture.h)
+	string capturePath;
+	// Espera os escritores em vez de descartar frames com a fila cheia (testes de regressão)
+	bool captureLossless = false;
+};
+Options options;
 
 // Função MAIN
-int main()
+int main(int argc, char **argv)
 {
-	// Inicialização da GLFW
-	glfwInit();
-
-	// Muita atenção aqui: alguns ambientes não aceitam essas configurações
-	// Você deve adaptar para a versão do OpenGL suportada por sua placa
-	// Sugestão: comente essas linhas de código para desobrir a versão e
-	// depois atualize (por exemplo: 4.5 com 4 e 5)
-	// glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
-	// glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
-	// glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
-
-	// Essencial para computadores da Apple
-	// #ifdef __APPLE__
-	//	glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
-	// #endif
-
-	// Criação da janela GLFW
-	GLFWwindow *window = glfwCreateWindow(WIDTH, HEIGHT, "Ola 3D -- Lucas M!", nullptr, nullptr);
-	if (window == NULL)
-	{
-		std::cout << "Failed to create GLFW window" << std::endl;
-		glfwTerminate();
+	if (!parseArguments(argc, argv))
+	{
+		printUsage(argv[0]);
 		return -1;
 	}
-	glfwMakeContextCurrent(window);
+	if (options.benchCullObjects)
+		return runCullBenchmark(options.benchCullObjects);
+	if (options.benchJobObjects)
+		return runJobBenchmark(options.benchJobObjects);
+
+	// Antes de tudo, para o perfil pegar também a carga da malha e dos shaders
+	if (!options.tracePath.empty())
+	{
+		cpuProfiler().setThreadName("principal");
+		const double overhead = cpuProfiler().measureOverhead();
+		cpuProfiler().enable();
+		cout << "Perfil da CPU: " << overhead << " ns por zona, gravado em " << options.tracePath << " ao sair (tecla T grava na hora)" << endl;
+	}
+
+	elapsedSeconds(); // começa a contar o tempo da animação
+
+	// Sem janela (--headless) o contexto vem direto da EGL e a GLFW não é usada
+	GLFWwindow *window = nullptr;
+	HeadlessContext headless;
+	if (options.headless)
+	{
+		if (!headless.create())
+			return -1;
+	}
+	else
+	{
+		// Inicialização da GLFW
+		glfwInit();
+
+		// Muita atenção aqui: alguns ambientes não aceitam essas configurações
+		// Você deve adaptar para a versão do OpenGL suportada por sua placa
+		// Sugestão: comente essas linhas de código para desobrir a versão e
+		// depois atualize (por exemplo: 4.5 com 4 e 5)
+		// glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+		// glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 6);
+		// glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+		// Essencial para computadores da Apple
+		// #ifdef __APPLE__
+		//	glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+		// #endif
+
+		// Criação da janela GLFW
+		window = glfwCreateWindow(options.width, options.height, "Ola 3D -- Lucas M!", nullptr, nullptr);
+		if (window == NULL)
+		{
+			std::cout << "Failed to create GLFW window" << std::endl;
+			glfwTerminate();
+			return -1;
+		}
+		glfwMakeContextCurrent(window);
 
-	// Fazendo o registro da função de callback para a janela GLFW
-	glfwSetKeyCallback(window, key_callback);
+		// Fazendo o registro da função de callback para a janela GLFW
+		glfwSetKeyCallback(window, key_callback);
+	}
 
 	// GLAD: carrega todos os ponteiros d funções da OpenGL
-	if (!gladLoadGLLoader((GLADloadproc)glfwGetProcAddress))
+	if (!gladLoadGLLoader(window ? (GLADloadproc)glfwGetProcAddress : (GLADloadproc)HeadlessContext::procAddress))
 	{
 		std::cout << "Failed to initialize GLAD" << std::endl;
 		glfwTerminate();
@@ -103,42 +245,264 @@ int main()
 	cout << "Renderer: " << renderer << endl;
 	cout << "OpenGL version supported " << version << endl;
 
+	const Capabilities &caps = detectCapabilities();
+	printCapabilities(caps);
+
+	// Buffers e VAOs são criados e editados por acesso direto (DSA), sem vincular
+	if (!caps.directStateAccess)
+	{
+		std::cout << "ERROR::GL::DIRECT_STATE_ACCESS_NOT_SUPPORTED (OpenGL 4.5 ou GL_ARB_direct_state_access)" << std::endl;
+		glfwTerminate();
+		return -1;
+	}
+
 	// Definindo as dimensões da viewport com as mesmas dimensões da janela da aplicação
-	int width, height;
-	glfwGetFramebufferSize(window, &width, &height);
-	glViewport(0, 0, width, height);
+	int width = options.width, height = options.height;
+	if (window)
+		glfwGetFramebufferSize(window, &width, &height);
+	RenderState &state = renderState();
+	state.viewport(0, 0, width, height);
+
+	// Sem janela não há framebuffer padrão: tudo é desenhado neste. O culling
+	// na GPU também desenha num framebuffer próprio (para ler a profundidade)
+	RenderTarget target;
+	if (options.headless)
+	{
+		if (!target.create(width, height))
+			return -1;
+		cout << "Sem janela: framebuffer de " << width << "x" << height << ", " << options.frames << " frames" << endl;
+	}
+
+	// Compilando e buildando o programa de shader: o principal compila em
+	// segundo plano enquanto a malha carrega e os primeiros frames usam o reserva
+	programCacheSettings().enabled = options.programCache;
+	ShaderManager shaders;
+	shaders.init();
+	ShaderPermutations hello3d;
+	GLuint fallbackShaderID = 0;
+	setupShader(shaders, hello3d, fallbackShaderID);
+
+	// Gerando os buffers (VBO + EBO) com a geometria da pirâmide (ou da malha carregada)
+	GPUMesh object = setupGeometry(options.vertexFormat);
+	if (object.VAO == 0)
+	{
+		shaders.destroy();
+		glDeleteProgram(fallbackShaderID);
+		glfwTerminate();
+		return -1;
+	}
+
+	// Centraliza/ajusta a escala da malha e desfaz a quantização das posições
+	// (identidade para a pirâmide em float)
+	glm::mat4 meshTransform = fitToUnitCube(object) * vertexDequantization(object.format);
+
+	// Cópias da malha numa grade (--instances). A transformação da malha vai
+	// junto na matriz de cada instância.
+	std::vector<glm::mat4> instances;
+	GLuint instanceBuffer = 0;
+	MeshArena arena;
+	DrawBatch batch;
+	if (options.instanceCount > 0)
+	{
+		if (options.batch)
+		{
+			// No lote a transformação de cada malha vai nos dados do comando (gl_DrawID)
+			instances = makeInstanceGrid(options.instanceCount, glm::mat4(1));
+			if (!setupBatch(object, meshTransform, instances, arena, batch))
+			{
+				deleteMesh(object);
+				shaders.destroy();
+				glDeleteProgram(fallbackShaderID);
+				glfwTerminate();
+				return -1;
+			}
+		}
+		else
+		{
+			instances = makeInstanceGrid(options.instanceCount, meshTransform);
+		}
+		meshTransform = glm::mat4(1);
+		if (!options.perObject && !options.stream && !options.batch)
+		{
+			instanceBuffer = createInstanceBuffer(instances);
+			attachInstanceBuffer(object.VAO, instanceBuffer);
+		}
+		cout << "Instancias: " << instances.size()
+				 << (options.batch ? " (multi-draw indireto)" : options.perObject ? " (um draw call por objeto)" : " (um draw call instanciado)") << endl;
+
+		// Sem vsync, para medir a vazão de desenho
+		if (window)
+			glfwSwapInterval(0);
+	}
+	// Sem buffer de instâncias o atributo vale a identidade
+	setIdentityInstanceAttribute();
+
+	// Instâncias animadas: as matrizes são escritas a cada frame direto num SSBO
+	// mapeado, dividido em regiões (uma por frame em voo) protegidas por cercas
+	FrameRing instanceRing;
+	if (options.stream && !options.batch && !instances.empty())
+	{
+		instanceRing.create(GL_SHADER_STORAGE_BUFFER, instances.size() * sizeof(glm::mat4), options.framesInFlight);
+		cout << "Buffer circular de instancias: " << instanceRing.regions() << " regioes, "
+				 << (instanceRing.persistent() ? "mapeamento persistente" : "glMapBufferRange a cada frame") << endl;
+	}
+
+	// Culling na GPU: a cena vai para um framebuffer próprio, cuja profundidade
+	// vira a pirâmide Hi-Z usada no frame seguinte
+	GpuCulling culling;
+	bool gpuCulled = false;
+	if (options.cull && !options.cullOnCpu && batch.objects())
+	{
+		gpuCulled = (target.id() || target.create(width, height)) && culling.create(shaders, arena, batch, width, height);
+		if (!gpuCulled)
+		{
+			culling.destroy();
+			if (!options.headless)
+				target.destroy();
+		}
+		else
+		{
+			culling.bindVisibleObjects();
+			cout << "Culling na GPU: frustum + Hi-Z (" << culling.levels() << " niveis, " << width << "x" << height << ")" << endl;
+		}
+	}
+
+	// Culling na CPU: pedido com --cull-cpu ou quando o da GPU não pôde ser criado
+	CpuBatchCulling cpuCulling;
+	if (options.cull && !gpuCulled && batch.objects() && cpuCulling.create(arena, batch, options.framesInFlight))
+		cout << "Culling na CPU: frustum, " << simdPathName(cpuCulling.simdPath()) << ", ate " << workerThreadCount() << " threads" << endl;
+	const bool cpuCulled = cpuCulling.active();
 
-	// Compilando e buildando o programa de shader
-	GLuint shaderID = setupShader();
+	// Recarga dos shaders em arquivo (todos os programas já foram enviados).
+	// O thread da recarga usa uma janela invisível: não existe sem janela
+	ShaderWatcher watcher;
+	if (options.hotReload && window && !options.benchmark && watcher.start(window, shaders))
+		cout << "Recarga de shaders: vigiando " << options.shaderDirectory << endl;
 
-	// Gerando um buffer simples, com a geometria de um triângulo
-	GLuint VAO = setupGeometry();
+	// Variante do programa para o modo de desenho escolhido (o culling entra por frame)
+	ShaderKey shaderKey = (instanceRing.id() ? SHADER_STREAMED : 0) | (batch.objects() ? SHADER_BATCHED : 0);
 
-	glUseProgram(shaderID);
+	// Troca de programa (reserva -> variante, ou entre variantes) e busca dos
+	// uniforms. No reserva os uniforms que ele não tem ficam com location -1.
+	// Um programa recarregado pode reaproveitar o nome de outro: os valores
+	// guardados no cache de estado são descartados.
+	GLuint shaderID = 0;
+	GLint modelLoc = -1, batchDrawOffsetLoc = -1;
+	auto useShader = [&](GLuint program)
+	{
+		shaderID = program;
+		state.forgetProgram(shaderID);
+		state.useProgram(shaderID);
+		batchDrawOffsetLoc = glGetUniformLocation(shaderID, "batchDrawOffset");
+		modelLoc = glGetUniformLocation(shaderID, "model");
+	};
+	useShader(hello3d.program(shaderKey, fallbackShaderID));
 
 	glm::mat4 model = glm::mat4(1); // matriz identidade;
-	GLint modelLoc = glGetUniformLocation(shaderID, "model");
 	//
 	model = glm::rotate(model, /*(GLfloat)glfwGetTime()*/ glm::radians(90.0f), glm::vec3(1.0f, 0.0f, 0.0f));
-	glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(model));
+	model = model * meshTransform;
+	state.uniform(modelLoc, model);
 
-	glEnable(GL_DEPTH_TEST);
+	state.enable(GL_DEPTH_TEST);
+
+	// Só existe um VAO em uso (o da malha ou o da arena)
+	const GLuint vertexArray = batch.objects() ? arena.gpu().VAO : object.VAO;
+	RenderQueue queue;
+
+	// Benchmark: todos os programas (inclusive a variante do culling) prontos
+	// antes do primeiro frame, para os frames não dependerem do compilador
+	FrameBenchmark benchmark;
+	if (options.benchmark)
+	{
+		if (cpuCulled || gpuCulled)
+			hello3d.request(shaderKey | SHADER_CULLED);
+		shaders.wait();
+		benchmark.create(options.warmupFrames, options.frames, 1.0 / 60.0);
+	}
+	const size_t frameLimit = options.benchmark ? benchmark.totalFrames() : options.frames;
+
+	// Captura do framebuffer que vai para a tela (ou do RenderTarget, sem janela)
+	FrameCapture capture;
+	if (!options.capturePath.empty())
+	{
+		int captureWidth = width, captureHeight = height;
+		if (window)
+			glfwGetFramebufferSize(window, &captureWidth, &captureHeight);
+		if (capture.create(options.capturePath, captureWidth, captureHeight, options.captureLossless))
+			cout << "Captura: " << captureWidth << "x" << captureHeight << (capture.isVideo() ? ", video Y4M em " : ", PNGs com prefixo ")
+					 << options.capturePath << ", " << capture.writerCount() << " escritores"
+					 << (capture.isLossless() ? ", sem descartar frames" : ", descarta frames com a fila cheia") << endl;
+	}
+
+	GpuProfiler gpuProfiler;
+	if (options.gpuProfile)
+	{
+		gpuProfiler.create();
+		queue.setProfiler(&gpuProfiler);
+	}
+
+	// Medição de desempenho das instâncias (impressa uma vez por segundo)
+	double statsStart = elapsedSeconds();
+	int statsFrames = 0;
+	double cpuCullSeconds = 0.0;
+	double traversalSeconds = 0.0;
+	const double loopStart = statsStart;
+	size_t frame = 0;
 
 	// Loop da aplicação - "game loop"
-	while (!glfwWindowShouldClose(window))
+	while (!(window && glfwWindowShouldClose(window)) && (frameLimit == 0 || frame < frameLimit))
 	{
+		ProfileZone frameZone("frame");
+		const bool measured = options.benchmark && benchmark.measuring(frame);
+		if (measured)
+			benchmark.beginFrame();
+		// Aquecimento do benchmark fora da conta (os tempos chegam
+		// GPU_PROFILER_FRAMES frames depois)
+		if (options.benchmark && frame == options.warmupFrames + GPU_PROFILER_FRAMES)
+			gpuProfiler.resetStats();
+		gpuProfiler.beginFrame();
+		gpuProfiler.begin("frame");
+
 		// Checa se houveram eventos de input (key pressed, mouse moved etc.) e chama as funções de callback correspondentes
-		glfwPollEvents();
+		if (window)
+		{
+			ProfileZone zone("eventos");
+			glfwPollEvents();
+		}
+
+		// Programas que terminaram de compilar (ou foram recarregados); a
+		// variante substitui o reserva
+		{
+			ProfileZone zone("shaders");
+			watcher.apply(shaders);
+			shaders.poll();
+		}
+
+		// O culling só começa quando a variante SHADER_CULLED (pedida aqui na
+		// primeira vez) e os compute shaders estão prontos; até lá o lote vai inteiro
+		const bool culled = (cpuCulled || (gpuCulled && culling.ready())) && hello3d.ready(shaderKey | SHADER_CULLED);
+		const GLuint program = hello3d.program(shaderKey | (culled ? SHADER_CULLED : 0), fallbackShaderID);
+		if (program != shaderID)
+			useShader(program);
+
+		if (target.id())
+			target.bind();
 
 		// Limpa o buffer de cor
-		glClearColor(1.0f, 1.0f, 1.0f, 1.0f); // cor de fundo
+		gpuProfiler.begin("limpeza");
+		state.clearColor(glm::vec4(1.0f, 1.0f, 1.0f, 1.0f)); // cor de fundo
 		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+		gpuProfiler.end();
 
-		glLineWidth(10);
-		glPointSize(20);
+		// Estado repetido a cada frame: o cache só manda para a OpenGL o que mudou
+		state.lineWidth(10);
+		state.pointSize(20);
 
-		float angle = (GLfloat)glfwGetTime();
+		// No benchmark o tempo da animação anda um passo fixo por frame
+		float angle = (GLfloat)(options.benchmark ? benchmark.time(frame) : elapsedSeconds());
 
+		ProfileZone matrixZone("matrizes");
 		model = glm::mat4(1);
 		if (rotateX)
 		{
@@ -152,30 +516,288 @@ int main()
 		{
 			model = glm::rotate(model, angle, glm::vec3(0.0f, 0.0f, 1.0f));
 		}
+		model = model * meshTransform;
+		matrixZone.end();
 
-		glUniformMatrix4fv(modelLoc, 1, GL_FALSE, glm::value_ptr(model));
-		// Chamada de desenho - drawcall
-		// Poligono Preenchido - GL_TRIANGLES
+		// Os draws do frame vão para a fila, que ordena por passo, programa,
+		// material, VAO e profundidade antes de desenhar (RenderQueue.h)
+		ProfileZone queueZone("montar fila");
+		queue.clear();
+		if (instances.empty())
+		{
+			// Chamada de desenho - drawcall
+			// Poligono Preenchido - GL_TRIANGLES
+			RenderCommand &triangles = queue.push(PASS_OPAQUE, shaderID, vertexArray);
+			triangles.count = object.indexCount;
+			triangles.indexType = object.indexType;
+			triangles.modelLocation = modelLoc;
+			triangles.model = model;
 
-		glBindVertexArray(VAO);
-		glDrawArrays(GL_TRIANGLES, 0, 18);
+			// Chamada de desenho - drawcall
+			// VÉRTICES - GL_POINTS (cada vértice único uma vez só; só na pirâmide,
+			// numa malha carregada os pontos cobririam tudo)
 
-		// Chamada de desenho - drawcall
-		// CONTORNO - GL_LINE_LOOP
+			if (options.meshPath.empty())
+			{
+				RenderCommand &points = queue.push(PASS_POINTS, shaderID, vertexArray);
+				points.type = DRAW_ARRAYS;
+				points.mode = GL_POINTS;
+				points.count = object.vertexCount;
+				points.modelLocation = modelLoc;
+				points.model = model;
+			}
+		}
+		else if (batch.objects())
+		{
+			// Todos os objetos de todas as malhas: um glMultiDrawElementsIndirect por material
+			if (culled && gpuCulled)
+			{
+				gpuProfiler.begin("culling");
+				culling.cull(model);
+				gpuProfiler.end();
+			}
+			else if (culled)
+			{
+				auto start = std::chrono::steady_clock::now();
+				cpuCulling.cull(model);
+				cpuCullSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			}
+			RenderCommand &draw = queue.push(PASS_OPAQUE, shaderID, vertexArray);
+			draw.type = DRAW_CALLBACK;
+			draw.draw = [&batch, batchDrawOffsetLoc]()
+			{ batch.draw(batchDrawOffsetLoc); };
+			draw.drawCalls = (uint32_t)batch.drawCallCount();
+			draw.modelLocation = modelLoc;
+			draw.model = model;
+		}
+		else if (instanceRing.id())
+		{
+			// A CPU escreve as matrizes na região deste frame; a GPU lê pelo SSBO.
+			// A animação é dividida em tarefas de 1024 objetos (JobSystem.h)
+			glm::mat4 *streamedModels = (glm::mat4 *)instanceRing.beginFrame();
+			jobSystem().parallelFor(instances.size(), 1024, [&](size_t first, size_t last)
+															{
+				for (size_t i = first; i < last; i++)
+					streamedModels[i] = spinInstance(instances[i], (uint32_t)i, angle); });
+			instanceRing.endWrite();
+			instanceRing.bindRange(STREAMED_INSTANCE_BINDING);
 
-		glDrawArrays(GL_POINTS, 0, 18);
-		glBindVertexArray(0);
+			RenderCommand &draw = queue.push(PASS_OPAQUE, shaderID, vertexArray);
+			draw.type = DRAW_ELEMENTS_INSTANCED;
+			draw.count = object.indexCount;
+			draw.indexType = object.indexType;
+			draw.instances = (GLsizei)instances.size();
+			draw.modelLocation = modelLoc;
+			draw.model = model;
+		}
+		else if (options.perObject)
+		{
+			// Um uniform + um draw call por objeto, de frente para trás. O percurso
+			// (matriz e profundidade de cada objeto) é dividido entre os núcleos
+			auto start = std::chrono::steady_clock::now();
+			queue.pushParallel(instances.size(), PASS_OPAQUE, shaderID, vertexArray, [&](size_t i, RenderCommand &draw)
+												 {
+				draw.model = model * instances[i];
+				draw.depth = draw.model[3].z * 0.5f + 0.5f;
+				draw.count = object.indexCount;
+				draw.indexType = object.indexType;
+				draw.modelLocation = modelLoc; });
+			traversalSeconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		}
+		else
+		{
+			// Todos os objetos num único draw call; a matriz de cada um vem do buffer de instâncias
+			RenderCommand &draw = queue.push(PASS_OPAQUE, shaderID, vertexArray);
+			draw.type = DRAW_ELEMENTS_INSTANCED;
+			draw.count = object.indexCount;
+			draw.indexType = object.indexType;
+			draw.instances = (GLsizei)instances.size();
+			draw.modelLocation = modelLoc;
+			draw.model = model;
+		}
+		queueZone.end();
+		queue.submit();
 
-		// Troca os buffers da tela
-		glfwSwapBuffers(window);
+		// Depois do desenho: Hi-Z do culling, cópia para a janela e cercas dos buffers circulares
+		ProfileZone afterZone("depois do desenho");
+		if (culled && gpuCulled)
+		{
+			gpuProfiler.begin("hi-z");
+			culling.buildHiZ(target);
+			gpuProfiler.end();
+		}
+		else if (culled)
+			cpuCulling.endFrame();
+		if (gpuCulled && window)
+		{
+			gpuProfiler.begin("copia para a janela");
+			target.blitToScreen();
+			gpuProfiler.end();
+		}
+		if (instanceRing.id())
+			instanceRing.endFrame();
+		if (capture.active())
+		{
+			gpuProfiler.begin("captura");
+			capture.capture(window ? 0 : target.id());
+			gpuProfiler.end();
+		}
+
+		gpuProfiler.end();
+		gpuProfiler.endFrame();
+		if (measured)
+			benchmark.endFrame(queue.drawCalls(), state.counters().issued);
+
+		afterZone.end();
+
+		// Troca os buffers da tela (sem janela: limita os frames em voo)
+		ProfileZone swapZone("troca de buffers");
+		if (window)
+			glfwSwapBuffers(window);
+		else
+			headless.present();
+		swapZone.end();
+		state.endFrame();
+		if (traceRequested)
+		{
+			traceRequested = false;
+			if (!options.tracePath.empty() && cpuProfiler().writeTrace(options.tracePath))
+				cout << "Perfil da CPU gravado em " << options.tracePath << endl;
+		}
+		frame++;
+
+		statsFrames++;
+		double statsElapsed = elapsedSeconds() - statsStart;
+		if (!instances.empty() && !options.benchmark && statsElapsed >= 1.0)
+		{
+			double frameMs = statsElapsed * 1000.0 / statsFrames;
+			cout << statsFrames / statsElapsed << " fps, " << frameMs << " ms/frame, "
+					 << instances.size() * statsFrames / statsElapsed / 1e6 << " milhoes de objetos/s, "
+					 << (options.perObject ? instances.size() : batch.objects() ? batch.drawCallCount() : 1) << " draw calls/frame" << endl;
+			// Chamadas de estado do último frame: feitas e puladas pelo cache (RenderState.h)
+			const RenderStateStats &calls = state.frameStats();
+			cout << "  estado GL: " << calls.issued << " chamadas, " << calls.filtered << " filtradas por frame" << endl;
+			// Custo de envio de cada passo da fila (média por frame)
+			cout << "  fila:";
+			for (int pass = 0; pass < PASS_COUNT; pass++)
+			{
+				RenderPassStats average = queue.averagePass((RenderPass)pass);
+				if (average.draws > 0)
+					cout << " " << renderPassName((RenderPass)pass) << " " << average.draws << " draws, " << average.stateCalls << " chamadas de estado, gravacao "
+							 << average.recordSeconds * 1000.0 << " ms, envio " << average.seconds * 1000.0 << " ms;";
+			}
+			cout << endl;
+			queue.resetStats();
+			if (instanceRing.id())
+			{
+				// Tempo que a CPU ficou parada esperando a GPU liberar uma região
+				FrameRingStats &ring = instanceRing.stats;
+				cout << "  espera pela GPU: " << ring.stallSeconds * 1000.0 / std::max(ring.frames, 1u) << " ms/frame em media, "
+						 << ring.waits << " de " << ring.frames << " frames esperaram, maior espera " << ring.maxStallSeconds * 1000.0 << " ms" << endl;
+				ring = FrameRingStats();
+			}
+			if (gpuCulled && culling.stats().valid)
+			{
+				// Contadores de alguns frames atrás (lidos sem esperar a GPU)
+				const CullStats &cull = culling.stats();
+				cout << "  culling: " << cull.visible << " visiveis, " << cull.frustumCulled << " fora do frustum, "
+						 << cull.occlusionCulled << " ocultos (de " << batch.objects() << " objetos)" << endl;
+			}
+			if (cpuCulled)
+			{
+				cout << "  culling na CPU: " << cpuCulling.visibleCount() << " visiveis, " << cpuCulling.objects() - cpuCulling.visibleCount()
+						 << " fora do frustum, " << cpuCullSeconds * 1000.0 / statsFrames << " ms/frame" << endl;
+				cpuCullSeconds = 0.0;
+			}
+			if (options.perObject)
+			{
+				cout << "  percurso da cena: " << traversalSeconds * 1000.0 / statsFrames << " ms/frame, ate " << workerThreadCount() << " threads" << endl;
+				traversalSeconds = 0.0;
+			}
+			if (gpuProfiler.active())
+			{
+				gpuProfiler.print();
+				gpuProfiler.resetStats();
+			}
+			statsStart = elapsedSeconds();
+			statsFrames = 0;
+		}
+	}
+	// Fecha o último frame medido logo depois do loop: a captura e a exportação
+	// do perfil não entram no tempo de CPU dele
+	if (options.benchmark)
+		benchmark.finish();
+	if (capture.active())
+	{
+		// Lê as últimas cópias e espera os escritores terminarem
+		capture.finish();
+		const FrameCaptureStats &captured = capture.captureStats();
+		cout << "Captura: " << captured.frames << " frames gravados em " << capture.capturePath() << ", " << captured.dropped
+				 << " descartados, copia do PBO "
+				 << captured.copySeconds * 1000.0 / std::max(captured.frames, 1u) << " ms/frame, esperou a GPU " << captured.gpuWaits << " vezes ("
+				 << captured.gpuWaitSeconds * 1000.0 << " ms) e os escritores " << captured.writerWaits << " vezes (" << captured.writerWaitSeconds * 1000.0
+				 << " ms)" << endl;
+	}
+	if (!options.tracePath.empty() && cpuProfiler().writeTrace(options.tracePath))
+		cout << "Perfil da CPU gravado em " << options.tracePath << endl;
+	if (options.benchmark)
+	{
+		benchmark.print();
+		gpuProfiler.finish();
+		if (gpuProfiler.active())
+			gpuProfiler.print();
+		std::vector<std::pair<string, string>> info = {{"renderer", (const char *)glGetString(GL_RENDERER)},
+																										{"version", (const char *)glGetString(GL_VERSION)},
+																										{"arguments", commandLine(argc, argv)},
+																										{"size", std::to_string(width) + "x" + std::to_string(height)}};
+		if (!options.benchJson.empty() && benchmark.writeJson(options.benchJson, info))
+			cout << "Benchmark gravado em " << options.benchJson << endl;
+		if (!options.benchCsv.empty() && benchmark.writeCsv(options.benchCsv))
+			cout << "Frames gravados em " << options.benchCsv << endl;
 	}
-	// Pede pra OpenGL desalocar os buffers
-	glDeleteVertexArrays(1, &VAO);
+	if (options.headless)
+	{
+		// Tempo total até a GPU terminar o último frame
+		glFinish();
+		const double seconds = elapsedSeconds() - loopStart;
+		cout << "Sem janela: " << frame << " frames em " << seconds << " s, " << seconds * 1000.0 / std::max<size_t>(frame, 1) << " ms/frame" << endl;
+	}
+	// Pede pra OpenGL desalocar os buffers (antes de destruir o contexto)
+	if (instanceBuffer)
+		glDeleteBuffers(1, &instanceBuffer);
+	instanceRing.destroy();
+	culling.destroy();
+	cpuCulling.destroy();
+	target.destroy();
+	batch.destroy();
+	arena.destroy();
+	deleteMesh(object);
+	watcher.stop();
+	shaders.destroy();
+	glDeleteProgram(fallbackShaderID);
+	benchmark.destroy();
+	gpuProfiler.destroy();
 	// Finaliza a execução da GLFW, limpando os recursos alocados por ela
 	glfwTerminate();
 	return 0;
 }
 
+// Argumentos do programa numa linha (vai no relatório do benchmark)
+string commandLine(int argc, char **argv)
+{
+	string line;
+	for (int i = 1; i < argc; i++)
+		line += (i > 1 ? " " : "") + string(argv[i]);
+	return line;
+}
+
+// Segundos desde a primeira chamada (com ou sem janela; glfwGetTime depende da GLFW)
+double elapsedSeconds()
+{
+	static const auto start = std::chrono::steady_clock::now();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
 // Função de callback de teclado - só pode ter uma instância (deve ser estática se
 // estiver dentro de uma classe) - É chamada sempre que uma tecla for pressionada
 // ou solta via GLFW
@@ -204,67 +826,79 @@ void key_callback(GLFWwindow *window, int key, int scancode, int action, int mod
 		rotateY = false;
 		rotateZ = true;
 	}
+
+	if (key == GLFW_KEY_T && action == GLFW_PRESS)
+		traceRequested = true;
 }
 
-// Esta função está basntante hardcoded - objetivo é compilar e "buildar" um programa de
-//  shader simples e único neste exemplo de código
-//  O código fonte do vertex e fragment shader está nos arrays vertexShaderSource e
-//  fragmentShader source no iniçio deste arquivo
-//  A função retorna o identificador do programa de shader
-int setupShader()
+// Esta função prepara o programa de shader deste exemplo
+//  O código fonte do vertex e fragment shader está em shaders/hello3d.vert e
+//  shaders/hello3d.frag; os bindings dos buffers e os recursos da variante
+//  entram como #define
+//  As variantes ficam em permutations e, em fallbackProgram, o programa reserva (já pronto)
+void setupShader(ShaderManager &shaders, ShaderPermutations &permutations, GLuint &fallbackProgram)
 {
-	// Vertex shader
-	GLuint vertexShader = glCreateShader(GL_VERTEX_SHADER);
-	glShaderSource(vertexShader, 1, &vertexShaderSource, NULL);
-	glCompileShader(vertexShader);
-	// Checando erros de compilação (exibição via log no terminal)
-	GLint success;
-	GLchar infoLog[512];
-	glGetShaderiv(vertexShader, GL_COMPILE_STATUS, &success);
-	if (!success)
-	{
-		glGetShaderInfoLog(vertexShader, 512, NULL, infoLog);
-		std::cout << "ERROR::SHADER::VERTEX::COMPILATION_FAILED\n"
-							<< infoLog << std::endl;
-	}
-	// Fragment shader
-	GLuint fragmentShader = glCreateShader(GL_FRAGMENT_SHADER);
-	glShaderSource(fragmentShader, 1, &fragmentShaderSource, NULL);
-	glCompileShader(fragmentShader);
-	// Checando erros de compilação (exibição via log no terminal)
-	glGetShaderiv(fragmentShader, GL_COMPILE_STATUS, &success);
-	if (!success)
-	{
-		glGetShaderInfoLog(fragmentShader, 512, NULL, infoLog);
-		std::cout << "ERROR::SHADER::FRAGMENT::COMPILATION_FAILED\n"
-							<< infoLog << std::endl;
-	}
-	// Linkando os shaders e criando o identificador do programa de shader
-	GLuint shaderProgram = glCreateProgram();
-	glAttachShader(shaderProgram, vertexShader);
-	glAttachShader(shaderProgram, fragmentShader);
-	glLinkProgram(shaderProgram);
-	// Checando por erros de linkagem
-	glGetProgramiv(shaderProgram, GL_LINK_STATUS, &success);
-	if (!success)
-	{
-		glGetProgramInfoLog(shaderProgram, 512, NULL, infoLog);
-		std::cout << "ERROR::SHADER::PROGRAM::LINKING_FAILED\n"
-							<< infoLog << std::endl;
-	}
-	glDeleteShader(vertexShader);
-	glDeleteShader(fragmentShader);
+	const string defines = "#define STREAMED_INSTANCE_BINDING " + to_string(STREAMED_INSTANCE_BINDING) + "\n" +
+												 "#define BATCH_DRAW_BINDING " + to_string(BATCH_DRAW_BINDING) + "\n" +
+												 "#define BATCH_OBJECT_BINDING " + to_string(BATCH_OBJECT_BINDING) + "\n" +
+												 "#define BATCH_VISIBLE_BINDING " + to_string(BATCH_VISIBLE_BINDING) + "\n";
+
+	permutations.create(shaders, "hello3d",
+											{{GL_VERTEX_SHADER, options.shaderDirectory + "/hello3d.vert"},
+											 {GL_FRAGMENT_SHADER, options.shaderDirectory + "/hello3d.frag"}},
+											defines,
+											{{SHADER_STREAMED, "STREAMED"}, {SHADER_BATCHED, "BATCHED"}, {SHADER_CULLED, "CULLED"}});
 
-	return shaderProgram;
+	// A variante que as opções vão usar vai para o driver já, sem esperar: ela
+	// compila em segundo plano (ou vem pronta do cache, ProgramCache.h)
+	// enquanto a malha carrega
+	const bool instanced = options.instanceCount > 0;
+	permutations.request((instanced && options.stream && !options.batch ? SHADER_STREAMED : 0) |
+											 (instanced && options.batch ? SHADER_BATCHED : 0));
+
+	// O reserva é pequeno e compila na hora
+	fallbackProgram = buildProgram("fallback", {{GL_VERTEX_SHADER, fallbackVertexShaderSource}, {GL_FRAGMENT_SHADER, fallbackFragmentShaderSource}});
 }
 
 // Esta função está bastante harcoded - objetivo é criar os buffers que armazenam a
-// geometria de um triângulo
-// Apenas atributo coordenada nos vértices
-// 1 VBO com as coordenadas, VAO com apenas 1 ponteiro para atributo
-// A função retorna o identificador do VAO
-int setupGeometry()
+// geometria da pirâmide (ou da malha passada em --mesh)
+// Atributos posição e cor nos vértices
+// 1 VBO com os vértices únicos, 1 EBO com os índices e o VAO que liga os dois
+// A função retorna a malha na GPU (VAO, buffers e informações para o desenho)
+GPUMesh setupGeometry(const VertexFormat &format)
 {
+	if (!options.meshPath.empty())
+	{
+		// Com um cache válido os dados vão direto do arquivo mapeado para a GPU
+		MeshCache cache;
+		if (options.meshCache && cache.open(options.meshPath, format))
+		{
+			auto start = std::chrono::steady_clock::now();
+			GPUMesh gpu = cache.upload();
+			double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			cout << "Malha " << options.meshPath << " (cache): " << gpu.vertexCount << " vertices, " << gpu.indexCount / 3
+					 << " triangulos, " << cache.size() / (1024.0 * 1024.0) << " MB enviados em " << seconds * 1000.0 << " ms" << endl;
+			return gpu;
+		}
+
+		IndexedMesh mesh;
+		if (!loadMesh(options.meshPath, mesh))
+			return GPUMesh();
+
+		optimizeMesh(mesh, options.meshPath.c_str());
+		PackedMesh packed = packMesh(mesh, format);
+		if (options.meshCache)
+			writeMeshCache(options.meshPath, packed);
+
+		GPUMesh gpu = uploadMeshData(packed.info, packed.vertexData.data(), packed.vertexData.size(),
+																 packed.indexData.data(), packed.indexData.size());
+		cout << "Geometria: " << gpu.vertexCount << " vertices (" << (size_t)gpu.vertexCount * gpu.format.stride
+				 << " bytes no VBO, formato " << vertexFormatName(gpu.format) << "), " << gpu.indexCount << " indices de "
+				 << indexTypeSize(gpu.indexType) * 8 << " bits" << endl;
+		return gpu;
+	}
+
+
 	// Aqui setamos as coordenadas x, y e z do triângulo e as armazenamos de forma
 	// sequencial, já visando mandar para o VBO (Vertex Buffer Objects)
 	// Cada atributo do vértice (coordenada, cores, coordenadas de textura, normal, etc)
@@ -390,46 +1024,499 @@ int setupGeometry()
 
 	};
 
-	GLuint VBO, VAO;
+	// Remove os vértices repetidos (mesma posição e cor) e gera os índices
+	const size_t expandedCount = sizeof(vertices) / (6 * sizeof(GLfloat));
+	IndexedMesh mesh = buildIndexedMesh(vertices, expandedCount);
+
+	// Reordena triângulos e vértices (cache pós-transformação, overdraw e busca de vértices)
+	optimizeMesh(mesh, "piramide");
+
+	// Envia os vértices únicos para o VBO e os índices para o EBO, ligados a um VAO
+	// (codificados no formato de vértice escolhido)
+	GPUMesh gpu = uploadMesh(mesh, format);
+
+	cout << "Geometria: " << expandedCount << " vertices -> " << gpu.vertexCount << " unicos ("
+			 << sizeof(vertices) << " -> " << (size_t)gpu.vertexCount * gpu.format.stride << " bytes no VBO, formato "
+			 << vertexFormatName(gpu.format) << " com " << gpu.format.stride << " bytes por vertice), "
+			 << gpu.indexCount << " indices de " << indexTypeSize(gpu.indexType) * 8 << " bits" << endl;
+
+	return gpu;
+}
+
+// Lote com multi-draw indireto: a malha principal, um cubo e um octaedro vão
+// para uma arena única e os objetos (placements) são distribuídos entre elas.
+// Todos usam o mesmo material (o único programa de shader).
+bool setupBatch(const GPUMesh &object, const glm::mat4 &objectTransform, const std::vector<glm::mat4> &placements,
+								MeshArena &arena, DrawBatch &batch)
+{
+	const Capabilities &caps = capabilities();
+	if (!caps.multiDrawIndirect || !caps.shaderDrawParameters)
+	{
+		std::cout << "ERROR::MESH_BATCH::NOT_SUPPORTED (GL_ARB_multi_draw_indirect e GL_ARB_shader_draw_parameters)" << std::endl;
+		return false;
+	}
+
+	// As formas extras usam a mesma codificação de vértice da malha principal
+	std::vector<GPUMesh> meshes = {object, uploadMesh(makeCubeMesh(), options.vertexFormat),
+																 uploadMesh(makeOctahedronMesh(), options.vertexFormat)};
+	std::vector<glm::mat4> transforms = {objectTransform};
+	for (size_t i = 1; i < meshes.size(); i++)
+		transforms.push_back(fitToUnitCube(meshes[i]) * vertexDequantization(meshes[i].format));
+
+	bool built = arena.build(meshes, transforms);
+	// As cópias individuais não são mais necessárias (a principal fica com o chamador)
+	for (size_t i = 1; i < meshes.size(); i++)
+		deleteMesh(meshes[i]);
+	if (!built)
+		return false;
+
+	std::vector<BatchObject> objects(placements.size());
+	for (size_t i = 0; i < placements.size(); i++)
+	{
+		objects[i].mesh = (uint32_t)(i % arena.meshCount());
+		objects[i].model = placements[i];
+	}
+	batch.build(arena, objects);
 
-	// Geração do identificador do VBO
-	glGenBuffers(1, &VBO);
+	const GPUMesh &gpu = arena.gpu();
+	cout << "Lote: " << arena.meshCount() << " malhas numa arena (" << gpu.vertexCount << " vertices, " << gpu.indexCount
+			 << " indices de " << indexTypeSize(gpu.indexType) * 8 << " bits), " << batch.commandCount() << " comandos indiretos, "
+			 << batch.drawCallCount() << " glMultiDrawElementsIndirect por frame" << endl;
+	return true;
+}
 
-	// Faz a conexão (vincula) do buffer como um buffer de array
-	glBindBuffer(GL_ARRAY_BUFFER, VBO);
+// --bench-cull: culling por frustum de count esferas aleatórias, comparando o
+// laço escalar com glm (vec4 por objeto) com os caminhos SIMD sobre SoA.
+// Cada caso roda várias vezes e vale o melhor tempo.
+int runCullBenchmark(size_t count)
+{
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> position(-50.0f, 50.0f), radius(0.1f, 1.0f);
+	std::vector<glm::vec4> sphereList(count);
+	SphereArrays spheres;
+	spheres.reserve(count);
+	for (glm::vec4 &sphere : sphereList)
+	{
+		sphere = glm::vec4(position(random), position(random), position(random), radius(random));
+		spheres.push_back(sphere);
+	}
 
-	// Envia os dados do array de floats para o buffer da OpenGl
-	glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
+	// Câmera fora da nuvem olhando para o centro: parte das esferas fica fora
+	glm::mat4 viewProjection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 120.0f) *
+														 glm::lookAt(glm::vec3(0.0f, 10.0f, -80.0f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	glm::vec4 planes[6];
+	extractFrustumPlanes(viewProjection, planes);
 
-	// Geração do identificador do VAO (Vertex Array Object)
-	glGenVertexArrays(1, &VAO);
+	const int repeats = (int)std::max<size_t>(3, std::min<size_t>(50, 20000000 / count));
+	auto measure = [&](auto run)
+	{
+		double best = 1e30;
+		for (int r = 0; r < repeats; r++)
+		{
+			auto start = std::chrono::steady_clock::now();
+			run();
+			best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+		}
+		return best;
+	};
+	auto report = [&](const string &name, double seconds, size_t visible, size_t differences)
+	{
+		cout << "  " << name << ": " << seconds * 1000.0 << " ms, " << count / seconds / 1e6 << " milhoes de objetos/s, "
+				 << visible << " visiveis";
+		if (differences)
+			cout << " (" << differences << " diferentes do escalar)";
+		cout << endl;
+	};
 
-	// Vincula (bind) o VAO primeiro, e em seguida  conecta e seta o(s) buffer(s) de vértices
-	// e os ponteiros para os atributos
-	glBindVertexArray(VAO);
+	cout << "Culling na CPU: " << count << " esferas, 6 planos, melhor de " << repeats << " execucoes" << endl;
 
-	// Para cada atributo do vertice, criamos um "AttribPointer" (ponteiro para o atributo), indicando:
-	//  Localização no shader * (a localização dos atributos devem ser correspondentes no layout especificado no vertex shader)
-	//  Numero de valores que o atributo tem (por ex, 3 coordenadas xyz)
-	//  Tipo do dado
-	//  Se está normalizado (entre zero e um)
-	//  Tamanho em bytes
-	//  Deslocamento a partir do byte zero
+	// Referência: um objeto por vez, glm escalar
+	std::vector<uint8_t> reference(count);
+	size_t referenceVisible = 0;
+	double seconds = measure([&]()
+													 {
+		referenceVisible = 0;
+		for (size_t i = 0; i < count; i++)
+		{
+			reference[i] = sphereInFrustum(planes, sphereList[i]);
+			referenceVisible += reference[i];
+		} });
+	report("glm escalar (AoS, 1 thread)", seconds, referenceVisible, 0);
+
+	auto compare = [&](const std::vector<uint8_t> &mask)
+	{
+		size_t differences = 0;
+		for (size_t i = 0; i < count; i++)
+			differences += maskVisible(mask, i) != (reference[i] != 0);
+		return differences;
+	};
+
+	std::vector<uint8_t> mask;
+	size_t visible = 0;
+	const SimdPath best = detectSimdPath();
+	for (SimdPath path : {SIMD_SCALAR, SIMD_SSE4, SIMD_AVX2})
+	{
+		if (path > best)
+			break;
+		seconds = measure([&]()
+											{ visible = cullSpheres(planes, spheres, mask, path, 1); });
+		report(string("SoA ") + simdPathName(path) + " (1 thread)", seconds, visible, compare(mask));
+	}
+
+	const unsigned threads = workerThreadCount();
+	seconds = measure([&]()
+										{ visible = cullSpheres(planes, spheres, mask, best, threads); });
+	report(string("SoA ") + simdPathName(best) + " (" + std::to_string(threads) + (threads == 1 ? " thread)" : " threads)"), seconds, visible, compare(mask));
+	return 0;
+}
+
+// --bench-jobs: um frame simulado como grafo de tarefas pequenas (animação ->
+// esferas envolventes -> culling, cada etapa dependendo da anterior), com 1, 2,
+// 4, ... trabalhadores até o número de núcleos. Mostra o ganho sobre 1 thread.
+int runJobBenchmark(size_t count)
+{
+	const size_t OBJECTS_PER_JOB = 128;
+	std::vector<glm::mat4> bases = makeInstanceGrid(count, glm::mat4(1.0f));
+	std::vector<glm::mat4> models(count);
+	std::vector<glm::vec4> spheres(count);
+	std::vector<uint8_t> visible(count);
+	const size_t jobCount = (count + OBJECTS_PER_JOB - 1) / OBJECTS_PER_JOB;
+	std::vector<size_t> jobVisible(jobCount);
+
+	// Câmera dentro da grade: parte dos objetos fica fora do frustum
+	glm::mat4 viewProjection = glm::perspective(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 100.0f) *
+														 glm::lookAt(glm::vec3(0.3f, 0.2f, 0.6f), glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+	glm::vec4 planes[6];
+	extractFrustumPlanes(viewProjection, planes);
+
+	// As três etapas de um objeto, por faixa de objetos
+	auto animate = [&](size_t first, size_t last, float time)
+	{
+		for (size_t i = first; i < last; i++)
+			models[i] = spinInstance(bases[i], (uint32_t)i, time);
+	};
+	auto bound = [&](size_t first, size_t last)
+	{
+		for (size_t i = first; i < last; i++)
+		{
+			const glm::mat4 &m = models[i];
+			float scale = std::max(glm::length(glm::vec3(m[0])), std::max(glm::length(glm::vec3(m[1])), glm::length(glm::vec3(m[2]))));
+			spheres[i] = glm::vec4(glm::vec3(m[3]), scale);
+		}
+	};
+	auto cull = [&](size_t job, size_t first, size_t last)
+	{
+		size_t n = 0;
+		for (size_t i = first; i < last; i++)
+			n += visible[i] = sphereInFrustum(planes, spheres[i]);
+		jobVisible[job] = n;
+	};
+	auto countVisible = [&]()
+	{
+		size_t n = 0;
+		for (size_t v : jobVisible)
+			n += v;
+		return n;
+	};
+
+	const int frames = (int)std::max<size_t>(10, std::min<size_t>(200, 20000000 / count));
+	cout << "Tarefas: " << count << " objetos, " << jobCount * 3 << " tarefas de " << OBJECTS_PER_JOB << " objetos por frame (3 etapas), "
+			 << frames << " frames" << endl;
+
+	// Referência: as mesmas etapas num laço, sem agendador
+	auto start = std::chrono::steady_clock::now();
+	for (int frame = 0; frame < frames; frame++)
+	{
+		animate(0, count, frame * 0.01f);
+		bound(0, count);
+		for (size_t job = 0; job < jobCount; job++)
+			cull(job, job * OBJECTS_PER_JOB, std::min(count, (job + 1) * OBJECTS_PER_JOB));
+	}
+	const double sequential = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / frames;
+	const size_t expected = countVisible();
+	cout << "  sequencial: " << sequential * 1000.0 << " ms/frame, " << expected << " visiveis" << endl;
+
+	std::vector<unsigned> threadCounts;
+	for (unsigned t = 1; t < workerThreadCount(); t *= 2)
+		threadCounts.push_back(t);
+	threadCounts.push_back(workerThreadCount());
+
+	double single = 0.0;
+	for (unsigned threads : threadCounts)
+	{
+		JobSystem jobs(threads);
+		auto frame = [&](float time)
+		{
+			// O grafo inteiro é enviado de uma vez; cada etapa espera a anterior pelo contador
+			JobCounter animated, bounded, culled;
+			for (size_t job = 0; job < jobCount; job++)
+			{
+				const size_t first = job * OBJECTS_PER_JOB, last = std::min(count, first + OBJECTS_PER_JOB);
+				jobs.run(animated, [&animate, first, last, time]()
+								 { animate(first, last, time); });
+			}
+			for (size_t job = 0; job < jobCount; job++)
+			{
+				const size_t first = job * OBJECTS_PER_JOB, last = std::min(count, first + OBJECTS_PER_JOB);
+				jobs.run(bounded, [&bound, first, last]()
+								 { bound(first, last); }, &animated);
+			}
+			for (size_t job = 0; job < jobCount; job++)
+			{
+				const size_t first = job * OBJECTS_PER_JOB, last = std::min(count, first + OBJECTS_PER_JOB);
+				jobs.run(culled, [&cull, job, first, last]()
+								 { cull(job, first, last); }, &bounded);
+			}
+			jobs.wait(culled);
+		};
 
-	// Atributo posição (x, y, z)
-	glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(GLfloat), (GLvoid *)0);
-	glEnableVertexAttribArray(0);
+		frame(0.0f); // aquece os threads e as filas
+		jobs.resetStats();
+		start = std::chrono::steady_clock::now();
+		for (int f = 0; f < frames; f++)
+			frame(f * 0.01f);
+		const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / frames;
+		if (threads == 1)
+			single = seconds;
 
-	// Atributo cor (r, g, b)
-	glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 6 * sizeof(GLfloat), (GLvoid *)(3 * sizeof(GLfloat)));
-	glEnableVertexAttribArray(1);
+		const JobStats stats = jobs.stats();
+		const size_t found = countVisible();
+		cout << "  " << threads << (threads == 1 ? " thread: " : " threads: ") << seconds * 1000.0 << " ms/frame, ganho "
+				 << single / seconds << "x, " << stats.executed / frames / seconds / 1e6 << " milhoes de tarefas/s, "
+				 << stats.stolen / frames << " roubadas e " << stats.immediate / frames << " executadas na hora por frame";
+		if (found != expected)
+			cout << " (" << found << " visiveis, diferente do sequencial)";
+		cout << endl;
+	}
+	return 0;
+}
 
-	// Observe que isso é permitido, a chamada para glVertexAttribPointer registrou o VBO como o objeto de buffer de vértice
-	// atualmente vinculado - para que depois possamos desvincular com segurança
-	glBindBuffer(GL_ARRAY_BUFFER, 0);
+// Lê as opções de linha de comando. Aceita "--opcao valor" e "--opcao=valor".
+bool parseArguments(int argc, char **argv)
+{
+	for (int i = 1; i < argc; i++)
+	{
+		string arg = argv[i];
+		string value;
+		size_t equals = arg.find('=');
+		bool hasValue = equals != string::npos;
+		if (hasValue)
+		{
+			value = arg.substr(equals + 1);
+			arg = arg.substr(0, equals);
+		}
+		// Opções com valor: o valor vem depois do '=' ou no próximo argumento
+		auto takeValue = [&]()
+		{
+			if (!hasValue && i + 1 < argc)
+			{
+				value = argv[++i];
+				hasValue = true;
+			}
+			if (!hasValue)
+				std::cout << "ERROR::ARGS::MISSING_VALUE " << arg << std::endl;
+			return hasValue;
+		};
 
-	// Desvincula o VAO (é uma boa prática desvincular qualquer buffer ou array para evitar bugs medonhos)
-	glBindVertexArray(0);
+		if (arg == "--mesh")
+		{
+			if (!takeValue())
+				return false;
+			options.meshPath = value;
+		}
+		else if (arg == "--instances")
+		{
+			if (!takeValue())
+				return false;
+			options.instanceCount = strtoul(value.c_str(), nullptr, 10);
+		}
+		else if (arg == "--per-object")
+		{
+			options.perObject = true;
+		}
+		else if (arg == "--stream")
+		{
+			options.stream = true;
+		}
+		else if (arg == "--frames-in-flight")
+		{
+			if (!takeValue())
+				return false;
+			options.framesInFlight = (unsigned)strtoul(value.c_str(), nullptr, 10);
+		}
+		else if (arg == "--batch")
+		{
+			options.batch = true;
+		}
+		else if (arg == "--cull")
+		{
+			options.batch = true;
+			options.cull = true;
+		}
+		else if (arg == "--cull-cpu")
+		{
+			options.batch = true;
+			options.cull = true;
+			options.cullOnCpu = true;
+		}
+		else if (arg == "--bench-cull")
+		{
+			// O número de esferas é opcional e só vem com '=' (--bench-cull=N)
+			options.benchCullObjects = hasValue ? strtoul(value.c_str(), nullptr, 10) : 1000000;
+			if (options.benchCullObjects == 0)
+			{
+				std::cout << "ERROR::ARGS::INVALID_VALUE " << arg << std::endl;
+				return false;
+			}
+		}
+		else if (arg == "--bench-jobs")
+		{
+			// Também opcional: --bench-jobs=N objetos
+			options.benchJobObjects = hasValue ? strtoul(value.c_str(), nullptr, 10) : 100000;
+			if (options.benchJobObjects == 0)
+			{
+				std::cout << "ERROR::ARGS::INVALID_VALUE " << arg << std::endl;
+				return false;
+			}
+		}
+		else if (arg == "--headless")
+		{
+			options.headless = true;
+		}
+		else if (arg == "--size")
+		{
+			if (!takeValue())
+				return false;
+			if (sscanf(value.c_str(), "%dx%d", &options.width, &options.height) != 2 || options.width <= 0 || options.height <= 0)
+			{
+				std::cout << "ERROR::ARGS::INVALID_SIZE " << value << std::endl;
+				return false;
+			}
+		}
+		else if (arg == "--frames")
+		{
+			if (!takeValue())
+				return false;
+			options.frames = strtoul(value.c_str(), nullptr, 10);
+			if (options.frames == 0)
+			{
+				std::cout << "ERROR::ARGS::INVALID_VALUE " << arg << std::endl;
+				return false;
+			}
+		}
+		else if (arg == "--capture")
+		{
+			if (!takeValue())
+				return false;
+			options.capturePath = value;
+		}
+		else if (arg == "--capture-lossless")
+		{
+			options.captureLossless = true;
+		}
+		else if (arg == "--trace")
+		{
+			if (!takeValue())
+				return false;
+			options.tracePath = value;
+		}
+		else if (arg == "--gpu-profile")
+		{
+			options.gpuProfile = true;
+		}
+		else if (arg == "--bench")
+		{
+			options.benchmark = true;
+		}
+		else if (arg == "--warmup")
+		{
+			if (!takeValue())
+				return false;
+			char *end = nullptr;
+			options.warmupFrames = strtoul(value.c_str(), &end, 10);
+			if (value.empty() || *end)
+			{
+				std::cout << "ERROR::ARGS::INVALID_VALUE " << arg << std::endl;
+				return false;
+			}
+		}
+		else if (arg == "--bench-json" || arg == "--bench-csv")
+		{
+			if (!takeValue())
+				return false;
+			(arg == "--bench-json" ? options.benchJson : options.benchCsv) = value;
+			options.benchmark = true;
+		}
+		else if (arg == "--no-mesh-cache")
+		{
+			options.meshCache = false;
+		}
+		else if (arg == "--no-program-cache")
+		{
+			options.programCache = false;
+		}
+		else if (arg == "--shaders")
+		{
+			if (!takeValue())
+				return false;
+			options.shaderDirectory = value;
+		}
+		else if (arg == "--no-hot-reload")
+		{
+			options.hotReload = false;
+		}
+		else if (arg == "--vertex-format")
+		{
+			if (!takeValue())
+				return false;
+			if (!parseVertexFormat(value, options.vertexFormat))
+			{
+				std::cout << "ERROR::ARGS::INVALID_VERTEX_FORMAT " << value << std::endl;
+				return false;
+			}
+		}
+		else
+		{
+			std::cout << "ERROR::ARGS::UNKNOWN_OPTION " << arg << std::endl;
+			return false;
+		}
+	}
+	// Sem janela não há como fechar: o número de frames é sempre fixo.
+	// No benchmark, --frames conta só os frames medidos
+	if (options.benchmark && options.frames == 0)
+		options.frames = 600;
+	if (options.headless && options.frames == 0)
+		options.frames = 300;
+	return true;
+}
 
-	return VAO;
+void printUsage(const char *program)
+{
+	std::cout << "Uso: " << program << " [opcoes]\n"
+						<< "  --mesh arquivo.obj|arquivo.ply        desenha a malha do arquivo no lugar da piramide\n"
+						<< "  --instances N                        desenha N copias da malha numa grade (um draw call instanciado)\n"
+						<< "  --per-object                         com --instances: um uniform + draw call por copia (para comparar)\n"
+						<< "  --stream                             com --instances: anima as copias na CPU e envia as matrizes a cada frame\n"
+						<< "  --frames-in-flight N                 regioes do buffer circular usado por --stream (padrao: 3)\n"
+						<< "  --batch                              com --instances: malha, cubo e octaedro numa arena, um multi-draw indireto\n"
+						<< "  --cull                               como --batch, com culling por frustum e Hi-Z num compute shader\n"
+						<< "  --cull-cpu                           como --batch, com culling por frustum na CPU (SIMD + threads)\n"
+						<< "  --bench-cull[=N]                     mede o culling na CPU com N esferas (padrao: 1000000) e sai\n"
+						<< "  --bench-jobs[=N]                     mede o agendador de tarefas num frame com N objetos (padrao: 100000) e sai\n"
+						<< "  --headless                           sem janela nem display (EGL surfaceless), desenha num framebuffer proprio\n"
+						<< "  --size LxA                           tamanho da janela ou do framebuffer (padrao: " << WIDTH << "x" << HEIGHT << ")\n"
+						<< "  --frames N                           para depois de N frames (padrao: ate fechar a janela; 300 com --headless)\n"
+						<< "  --capture caminho                    grava os frames sem parar o loop: video.y4m, ou prefixo de PNGs (prefixo_000000.png)\n"
+						<< "  --capture-lossless                   com --capture: espera a gravacao em vez de descartar frames (testes de regressao)\n"
+						<< "  --trace arquivo.json                 perfil da CPU por thread (Chrome Trace / Perfetto), gravado ao sair e na tecla T\n"
+						<< "  --gpu-profile                        tempo de GPU por trecho do frame (limpeza, culling, passos da fila, Hi-Z, copia)\n"
+						<< "  --bench                              frames reprodutiveis (passo fixo de 1/60 s) e relatorio de media/p50/p95/p99/max\n"
+						<< "  --warmup N                           com --bench: frames de aquecimento fora da conta (padrao: 60; --frames: 600 medidos)\n"
+						<< "  --bench-json arquivo                 com --bench: grava o resumo em JSON\n"
+						<< "  --bench-csv arquivo                  com --bench: grava um frame por linha em CSV\n"
+						<< "  --no-mesh-cache                      sempre le a malha do arquivo original (nao usa/grava .meshcache)\n"
+						<< "  --no-program-cache                   sempre compila os shaders (nao usa/grava .programcache/)\n"
+						<< "  --shaders DIR                        diretorio dos arquivos de shader (padrao: " << SHADER_DIRECTORY << ")\n"
+						<< "  --no-hot-reload                      nao recompila os shaders quando os arquivos mudam\n"
+						<< "  --vertex-format float|half|snorm16   codificacao dos vertices no VBO (padrao: snorm16)\n";
 }